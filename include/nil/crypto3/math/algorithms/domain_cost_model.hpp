@@ -0,0 +1,271 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_DOMAIN_COST_MODEL_HPP
+#define CRYPTO3_MATH_DOMAIN_COST_MODEL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/math/type_traits.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            enum class evaluation_domain_kind {
+                basic_radix2,
+                extended_radix2,
+                step_radix2,
+                geometric_sequence,
+                arithmetic_sequence
+            };
+
+            inline const char *evaluation_domain_name(evaluation_domain_kind kind) {
+                switch (kind) {
+                    case evaluation_domain_kind::basic_radix2:
+                        return "basic_radix2";
+                    case evaluation_domain_kind::extended_radix2:
+                        return "extended_radix2";
+                    case evaluation_domain_kind::step_radix2:
+                        return "step_radix2";
+                    case evaluation_domain_kind::geometric_sequence:
+                        return "geometric_sequence";
+                    case evaluation_domain_kind::arithmetic_sequence:
+                        return "arithmetic_sequence";
+                }
+                return "unknown";
+            }
+
+            /**
+             * Relative cost of the operations the transforms are made of, in units of one field multiplication.
+             * The defaults suit large prime fields; calibrate_domain_cost_model measures them on the host.
+             */
+            struct domain_cost_model {
+                double multiplication = 1.0;
+                double addition = 0.1;
+                /* One radix-2 butterfly: a multiplication, an addition and a subtraction plus memory traffic */
+                double butterfly = 1.3;
+                double inversion = 100.0;
+
+                /* A radix-2 FFT of size n */
+                double radix2(std::size_t n) const {
+                    return n < 2 ? 0.0 : butterfly * double(n / 2) * std::log2(double(n));
+                }
+            };
+
+            struct evaluation_domain_candidate {
+                evaluation_domain_kind kind;
+                std::size_t size;
+                /* Estimated cost of one fft, see domain_cost_model */
+                double cost;
+            };
+
+            namespace detail {
+                inline std::size_t ceil_log2(std::size_t n) {
+                    return static_cast<std::size_t>(std::ceil(std::log2(n)));
+                }
+
+                /*
+                 * Cost of one forward transform of each domain kind, counted from the implementations.
+                 */
+                inline double estimate_domain_cost(evaluation_domain_kind kind,
+                                                   std::size_t m,
+                                                   std::size_t two_adicity,
+                                                   const domain_cost_model &model) {
+                    switch (kind) {
+                        case evaluation_domain_kind::basic_radix2:
+                            return model.radix2(m);
+                        case evaluation_domain_kind::extended_radix2: {
+                            const std::size_t cosets = m >> two_adicity;
+                            return double(cosets) * model.radix2(m / cosets) +
+                                   double(m) * (double(cosets) * model.multiplication + model.multiplication);
+                        }
+                        case evaluation_domain_kind::step_radix2: {
+                            const std::size_t big_m = std::size_t(1) << (ceil_log2(m) - 1);
+                            return model.radix2(big_m) + model.radix2(m - big_m) +
+                                   double(big_m) * (2 * model.multiplication + 3 * model.addition);
+                        }
+                        case evaluation_domain_kind::geometric_sequence: {
+                            /* Two products with cached FFT images, each two transforms of size 2m and two passes */
+                            const std::size_t n = power_of_two(2 * m - 1);
+                            return 4 * model.radix2(n) + double(4 * n + 3 * m) * model.multiplication;
+                        }
+                        case evaluation_domain_kind::arithmetic_sequence: {
+                            /* Basis change through the subproduct tree plus per-call inversions */
+                            const std::size_t n = power_of_two(2 * m);
+                            return 3 * double(ceil_log2(m)) * model.radix2(n) + double(m) * 2 * model.inversion;
+                        }
+                    }
+                    return 0;
+                }
+            }    // namespace detail
+
+            /**
+             * Feasible domains of size at least m, cheapest first. Ties go to the smaller domain.
+             */
+            template<typename FieldType>
+            std::vector<evaluation_domain_candidate>
+                evaluation_domain_candidates(std::size_t m, const domain_cost_model &model = domain_cost_model()) {
+                std::vector<evaluation_domain_candidate> result;
+                if (m <= 1) {
+                    return result;
+                }
+
+                const std::size_t s = fields::arithmetic_params<FieldType>::s;
+                auto add = [&](evaluation_domain_kind kind, std::size_t size) {
+                    for (const evaluation_domain_candidate &c : result) {
+                        if (c.kind == kind && c.size == size) {
+                            return;
+                        }
+                    }
+                    result.push_back({kind, size, detail::estimate_domain_cost(kind, size, s, model)});
+                };
+
+                const std::size_t rounded = detail::power_of_two(m);
+                const std::size_t big = rounded == m ? m / 2 : rounded / 2;
+                const std::size_t rounded_small = detail::power_of_two(m - big);
+
+                for (std::size_t size : {m, big + rounded_small, rounded}) {
+                    if (detail::is_basic_radix2_domain<FieldType>(size)) {
+                        add(evaluation_domain_kind::basic_radix2, size);
+                    }
+                    if (detail::is_extended_radix2_domain<FieldType>(size)) {
+                        add(evaluation_domain_kind::extended_radix2, size);
+                    }
+                    if (detail::is_step_radix2_domain<FieldType>(size)) {
+                        add(evaluation_domain_kind::step_radix2, size);
+                    }
+                }
+
+                /* The sequence domains multiply through radix-2 FFTs of twice their size */
+                if (detail::is_geometric_sequence_domain<FieldType>(m) && detail::ceil_log2(2 * m - 1) <= s) {
+                    add(evaluation_domain_kind::geometric_sequence, m);
+                }
+                if (detail::is_arithmetic_sequence_domain<FieldType>(m) && detail::power_of_two(m) == m &&
+                    detail::ceil_log2(2 * m) <= s) {
+                    add(evaluation_domain_kind::arithmetic_sequence, m);
+                }
+
+                std::stable_sort(result.begin(), result.end(),
+                                 [](const evaluation_domain_candidate &a, const evaluation_domain_candidate &b) {
+                                     return a.cost < b.cost || (a.cost == b.cost && a.size < b.size);
+                                 });
+                return result;
+            }
+
+            /**
+             * Human-readable report of the candidates for m and their estimated costs, the chosen one first.
+             */
+            template<typename FieldType>
+            std::string explain_domain_choice(std::size_t m, const domain_cost_model &model = domain_cost_model()) {
+                const std::vector<evaluation_domain_candidate> candidates =
+                    evaluation_domain_candidates<FieldType>(m, model);
+
+                std::ostringstream out;
+                out << "evaluation domain for m = " << m << ":";
+                if (candidates.empty()) {
+                    out << " no feasible domain";
+                }
+                for (std::size_t i = 0; i < candidates.size(); i++) {
+                    out << (i == 0 ? "\n  * " : "\n    ") << evaluation_domain_name(candidates[i].kind)
+                        << " size = " << candidates[i].size << " cost = " << candidates[i].cost;
+                }
+                return out.str();
+            }
+
+            /**
+             * Measure the cost model on this machine: operations are timed on the field and expressed
+             * relative to one multiplication. Takes a few milliseconds for the default log_size.
+             */
+            template<typename FieldType>
+            domain_cost_model calibrate_domain_cost_model(std::size_t log_size = 12) {
+                typedef typename FieldType::value_type value_type;
+                typedef std::chrono::steady_clock clock;
+
+                log_size = std::min<std::size_t>(log_size, fields::arithmetic_params<FieldType>::s);
+                const std::size_t n = std::size_t(1) << log_size;
+
+                std::vector<value_type> a(n);
+                value_type x = value_type(fields::arithmetic_params<FieldType>::multiplicative_generator);
+                for (std::size_t i = 0; i < n; i++) {
+                    a[i] = x;
+                    x *= x + value_type::one();
+                }
+
+                auto seconds = [](clock::time_point start) {
+                    return std::chrono::duration<double>(clock::now() - start).count();
+                };
+
+                clock::time_point start = clock::now();
+                value_type acc = value_type::one();
+                for (std::size_t i = 0; i < n; i++) {
+                    acc *= a[i];
+                }
+                const double multiplication = seconds(start) / double(n);
+
+                start = clock::now();
+                value_type sum = acc;
+                for (std::size_t i = 0; i < n; i++) {
+                    sum += a[i];
+                }
+                const double addition = seconds(start) / double(n);
+
+                const std::size_t inversions = 16;
+                start = clock::now();
+                value_type inverse = sum;
+                for (std::size_t i = 0; i < inversions; i++) {
+                    inverse = (inverse + a[i]).inversed();
+                }
+                const double inversion = seconds(start) / double(inversions);
+
+                start = clock::now();
+                detail::basic_serial_radix2_fft<FieldType>(a, unity_root<FieldType>(n));
+                const double butterfly = seconds(start) / (double(n / 2) * double(log_size));
+
+                /* Keep the timed loops observable */
+                volatile bool sink = (acc == inverse) || (a[0] == sum);
+                (void)sink;
+
+                domain_cost_model model;
+                if (multiplication > 0) {
+                    model.addition = addition / multiplication;
+                    model.butterfly = butterfly / multiplication;
+                    model.inversion = inversion / multiplication;
+                }
+                return model;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_DOMAIN_COST_MODEL_HPP
@@ -34,6 +34,7 @@
 #include <nil/crypto3/math/domains/step_radix2_domain.hpp>
 
 #include <nil/crypto3/math/type_traits.hpp>
+#include <nil/crypto3/math/algorithms/domain_cost_model.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -44,65 +45,41 @@ namespace nil {
              A convenience method for choosing an evaluation domain
              Returns an evaluation domain object in which the domain S has size
              |S| >= MinSize.
-             The function get_evaluation_domain is chosen from different supported domains,
-             depending on MinSize.
+             The domain is the cheapest feasible one under the cost model, see evaluation_domain_candidates and
+             explain_domain_choice.
             */
             template<typename FieldType>
-            std::shared_ptr<evaluation_domain<FieldType>> make_evaluation_domain(std::size_t m) {
+            std::shared_ptr<evaluation_domain<FieldType>>
+                make_evaluation_domain(std::size_t m, const domain_cost_model &model = domain_cost_model()) {
                 typedef std::shared_ptr<evaluation_domain<FieldType>> result_type;
 
-                const std::size_t big = 1ul << (std::size_t(std::ceil(std::log2(m))) - 1);
-                const std::size_t rounded_small = (1ul << std::size_t(std::ceil(std::log2(m - big))));
-
-                if (detail::is_basic_radix2_domain<FieldType>(m)) {
-                    result_type result;
-                    result.reset(new basic_radix2_domain<FieldType>(m));
-                    return result;
-                }
-
-                if (detail::is_extended_radix2_domain<FieldType>(m)) {
-                    result_type result;
-                    result.reset(new extended_radix2_domain<FieldType>(m));
-                    return result;
-                }
-
-                if (detail::is_step_radix2_domain<FieldType>(m)) {
-                    result_type result;
-                    result.reset(new step_radix2_domain<FieldType>(m));
-                    return result;
-                }
-
-                if (detail::is_basic_radix2_domain<FieldType>(big + rounded_small)) {
-                    result_type result;
-                    result.reset(new basic_radix2_domain<FieldType>(big + rounded_small));
-                    return result;
+                const std::vector<evaluation_domain_candidate> candidates =
+                    evaluation_domain_candidates<FieldType>(m, model);
+                if (candidates.empty()) {
+                    return result_type();
                 }
 
-                if (detail::is_extended_radix2_domain<FieldType>(big + rounded_small)) {
-                    result_type result;
-                    result.reset(new extended_radix2_domain<FieldType>(big + rounded_small));
-                    return result;
+                const evaluation_domain_candidate &best = candidates.front();
+
+                result_type result;
+                switch (best.kind) {
+                    case evaluation_domain_kind::basic_radix2:
+                        result.reset(new basic_radix2_domain<FieldType>(best.size));
+                        break;
+                    case evaluation_domain_kind::extended_radix2:
+                        result.reset(new extended_radix2_domain<FieldType>(best.size));
+                        break;
+                    case evaluation_domain_kind::step_radix2:
+                        result.reset(new step_radix2_domain<FieldType>(best.size));
+                        break;
+                    case evaluation_domain_kind::geometric_sequence:
+                        result.reset(new geometric_sequence_domain<FieldType>(best.size));
+                        break;
+                    case evaluation_domain_kind::arithmetic_sequence:
+                        result.reset(new arithmetic_sequence_domain<FieldType>(best.size));
+                        break;
                 }
-
-                if (detail::is_step_radix2_domain<FieldType>(big + rounded_small)) {
-                    result_type result;
-                    result.reset(new step_radix2_domain<FieldType>(big + rounded_small));
-                    return result;
-                }
-
-                if (detail::is_geometric_sequence_domain<FieldType>(m)) {
-                    result_type result;
-                    result.reset(new geometric_sequence_domain<FieldType>(m));
-                    return result;
-                }
-
-                if (detail::is_arithmetic_sequence_domain<FieldType>(m)) {
-                    result_type result;
-                    result.reset(new arithmetic_sequence_domain<FieldType>(m));
-                    return result;
-                }
-
-                return result_type();
+                return result;
             }
         }    // namespace math
     }        // namespace crypto3
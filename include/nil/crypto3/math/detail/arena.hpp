@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_DETAIL_ARENA_HPP
+#define CRYPTO3_MATH_DETAIL_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /*
+                 * The innermost arena installed on the calling thread, null if there is none.
+                 */
+                inline std::pmr::memory_resource *&current_arena() {
+                    thread_local std::pmr::memory_resource *resource = nullptr;
+                    return resource;
+                }
+            }    // namespace detail
+
+            /**
+             * Memory resource for allocations made on the calling thread: the innermost arena installed on it,
+             * or the global heap when there is none.
+             */
+            inline std::pmr::memory_resource *arena_resource() {
+                std::pmr::memory_resource *resource = detail::current_arena();
+                return resource != nullptr ? resource : std::pmr::new_delete_resource();
+            }
+
+            /**
+             * Scoped monotonic arena. While it is alive, the internal temporaries of the polynomial operations and
+             * the evaluation domains created on this thread, as well as containers using arena_allocator, take
+             * their memory from it. Deallocation is a no-op and everything is released at once when the arena is
+             * destroyed, so nothing allocated from it may outlive it.
+             *
+             * Arenas nest in LIFO order, an inner arena drawing its chunks from the outer one. Worker threads of
+             * parallel regions do not see the arena of the thread that spawned them and keep using the heap for
+             * their own temporaries; allocations through an arena_allocator handed to them are serialized.
+             */
+            class arena : public std::pmr::memory_resource {
+            public:
+                arena() : previous(detail::current_arena()), pool(arena_resource()) {
+                    detail::current_arena() = this;
+                }
+
+                /**
+                 * Arena whose first chunk holds initial_size bytes.
+                 */
+                explicit arena(std::size_t initial_size) :
+                    previous(detail::current_arena()), pool(std::max<std::size_t>(initial_size, 1), arena_resource()) {
+                    detail::current_arena() = this;
+                }
+
+                /**
+                 * Arena that first uses the caller's buffer of size bytes and only then falls back to the
+                 * enclosing arena or the heap.
+                 */
+                arena(void *buffer, std::size_t size) :
+                    previous(detail::current_arena()), pool(buffer, size, arena_resource()) {
+                    detail::current_arena() = this;
+                }
+
+                arena(const arena &) = delete;
+                arena &operator=(const arena &) = delete;
+
+                ~arena() override {
+                    detail::current_arena() = previous;
+                }
+
+            private:
+                void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return pool.allocate(bytes, alignment);
+                }
+
+                void do_deallocate(void *, std::size_t, std::size_t) override {
+                }
+
+                bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+                    return this == &other;
+                }
+
+                std::pmr::memory_resource *previous;
+                std::pmr::monotonic_buffer_resource pool;
+                std::mutex mutex;
+            };
+
+            /**
+             * Allocator drawing from the arena_resource() current when it was constructed. Containers built
+             * inside an arena scope use the arena, elsewhere the heap, e.g. polynomial<value_type,
+             * arena_allocator<value_type>> runs a whole stage without global-heap traffic.
+             */
+            template<typename T>
+            class arena_allocator {
+            public:
+                typedef T value_type;
+
+                arena_allocator() noexcept : resource(arena_resource()) {
+                }
+
+                explicit arena_allocator(std::pmr::memory_resource *r) noexcept : resource(r) {
+                }
+
+                template<typename U>
+                arena_allocator(const arena_allocator<U> &other) noexcept : resource(other.resource) {
+                }
+
+                T *allocate(std::size_t n) {
+                    if (n > std::size_t(-1) / sizeof(T)) {
+                        throw std::bad_array_new_length();
+                    }
+                    return static_cast<T *>(resource->allocate(n * sizeof(T), alignof(T)));
+                }
+
+                void deallocate(T *p, std::size_t n) noexcept {
+                    resource->deallocate(p, n * sizeof(T), alignof(T));
+                }
+
+                template<typename U>
+                bool operator==(const arena_allocator<U> &other) const noexcept {
+                    return resource == other.resource || resource->is_equal(*other.resource);
+                }
+
+                template<typename U>
+                bool operator!=(const arena_allocator<U> &other) const noexcept {
+                    return !(*this == other);
+                }
+
+                std::pmr::memory_resource *resource;
+            };
+
+            namespace detail {
+                /*
+                 * Vector for internal temporaries, allocated from the current arena if one is installed.
+                 */
+                template<typename T>
+                using scratch_vector = std::vector<T, arena_allocator<T>>;
+            }    // namespace detail
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_DETAIL_ARENA_HPP
@@ -28,6 +28,7 @@
 
 #include <type_traits>
 #include <complex>
+#include <vector>
 
 #include <boost/math/constants/constants.hpp>
 #include <nil/crypto3/algebra/fields/params.hpp>
@@ -60,6 +61,35 @@ namespace nil {
                     return n;
                 }
 
+                /*
+                 * Invert every element of a in place with a single field inversion (Montgomery's trick).
+                 * Expects all elements to be non-zero.
+                 */
+                template<typename Range>
+                void batch_inversion(Range &a) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    const std::size_t n = std::distance(std::begin(a), std::end(a));
+                    if (n == 0) {
+                        return;
+                    }
+
+                    std::vector<value_type> prefix(n);
+                    value_type acc = value_type::one();
+                    for (std::size_t i = 0; i < n; ++i) {
+                        prefix[i] = acc;
+                        acc *= a[i];
+                    }
+
+                    acc = acc.inversed();
+                    for (std::size_t i = n; i-- > 0;) {
+                        const value_type inverse = acc * prefix[i];
+                        acc *= a[i];
+                        a[i] = inverse;
+                    }
+                }
+
                 template<typename FieldType>
                 typename FieldType::value_type coset_shift() {
                     return
@@ -0,0 +1,401 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_DETAIL_PRECOMPUTATION_HPP
+#define CRYPTO3_MATH_DETAIL_PRECOMPUTATION_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CRYPTO3_MATH_PRECOMPUTATION_MMAP
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+
+                /**
+                 * Immutable table of precomputed values, either owned or viewing storage kept alive by owner.
+                 * Copies share the underlying storage.
+                 */
+                template<typename T>
+                class precomputed_table {
+                public:
+                    typedef T value_type;
+                    typedef const T *const_iterator;
+
+                    precomputed_table() : first(nullptr), count(0) {
+                    }
+
+                    precomputed_table(std::vector<T> &&values) {
+                        std::shared_ptr<std::vector<T>> storage = std::make_shared<std::vector<T>>(std::move(values));
+                        first = storage->data();
+                        count = storage->size();
+                        owner = std::move(storage);
+                    }
+
+                    precomputed_table(std::shared_ptr<const void> owner, const T *first, std::size_t count) :
+                        owner(std::move(owner)), first(first), count(count) {
+                    }
+
+                    std::size_t size() const {
+                        return count;
+                    }
+
+                    bool empty() const {
+                        return count == 0;
+                    }
+
+                    const T *data() const {
+                        return first;
+                    }
+
+                    const_iterator begin() const {
+                        return first;
+                    }
+
+                    const_iterator end() const {
+                        return first + count;
+                    }
+
+                    const T &operator[](std::size_t idx) const {
+                        return first[idx];
+                    }
+
+                private:
+                    std::shared_ptr<const void> owner;
+                    const T *first;
+                    std::size_t count;
+                };
+
+                /*
+                 * Precomputation file format, version 2, native byte order:
+                 * - precomputation_header, 64 bytes;
+                 * - tables directory: tables x { uint64 offset, uint64 count }, offsets from the start of the file;
+                 * - tables, each starting at a multiple of precomputation_alignment, of count elements stored as
+                 *   described by precomputation_element.
+                 * The fingerprint binds a file to the field and the domain parameters it was computed for, so a
+                 * stale or foreign file is rejected instead of being silently misused. Version 1 stored the object
+                 * representation of the elements and is refused.
+                 */
+                constexpr static const char precomputation_magic[8] = {'C', '3', 'M', 'A', 'T', 'H', 'P', 'C'};
+                constexpr static const std::uint32_t precomputation_version = 2;
+                constexpr static const std::uint32_t precomputation_byte_order = 0x01020304;
+                constexpr static const std::size_t precomputation_alignment = 64;
+
+                struct precomputation_header {
+                    char magic[8];
+                    std::uint32_t version;
+                    std::uint32_t byte_order;
+                    std::uint32_t kind;
+                    std::uint32_t element_size;
+                    std::uint64_t size;
+                    std::uint64_t fingerprint;
+                    std::uint64_t tables;
+                    std::uint8_t reserved[16];
+                };
+
+                static_assert(sizeof(precomputation_header) == 64, "unexpected precomputation_header layout");
+
+                /*
+                 * On-disk form of a field element: the 64-bit limbs of its integral representation, least
+                 * significant first. Field elements wrap multiprecision numbers, so their object representation
+                 * is neither trivially copyable nor stable across builds.
+                 */
+                template<typename ValueType>
+                struct precomputation_element {
+                    typedef typename ValueType::field_type field_type;
+                    typedef typename field_type::integral_type integral_type;
+
+                    constexpr static const std::size_t limbs = (field_type::value_bits + 63) / 64;
+                    constexpr static const std::size_t size = limbs * sizeof(std::uint64_t);
+
+                    static void write(const ValueType &value, std::uint64_t *out) {
+                        integral_type x = integral_type(value.data);
+                        for (std::size_t i = 0; i < limbs; i++) {
+                            if (i > 0) {
+                                x >>= 64;
+                            }
+                            out[i] = static_cast<std::uint64_t>(x & integral_type(0xFFFFFFFFFFFFFFFFULL));
+                        }
+                    }
+
+                    static ValueType read(const std::uint64_t *in) {
+                        integral_type x = integral_type(in[limbs - 1]);
+                        for (std::size_t i = limbs - 1; i > 0; i--) {
+                            x <<= 64;
+                            x |= integral_type(in[i - 1]);
+                        }
+                        return ValueType(x);
+                    }
+                };
+
+                /*
+                 * FNV-1a over the on-disk form of the values.
+                 */
+                template<typename T>
+                std::uint64_t precomputation_fingerprint(std::initializer_list<T> values) {
+                    typedef precomputation_element<T> element;
+
+                    std::uint64_t hash = 0xcbf29ce484222325ULL;
+                    for (const T &value : values) {
+                        std::uint64_t limbs[element::limbs];
+                        element::write(value, limbs);
+                        for (std::uint64_t limb : limbs) {
+                            for (std::size_t i = 0; i < sizeof(limb); i++) {
+                                hash = (hash ^ ((limb >> (8 * i)) & 0xFF)) * 0x100000001b3ULL;
+                            }
+                        }
+                    }
+                    return hash;
+                }
+
+                /**
+                 * Write the tables to path. The file is written next to its destination and renamed into place,
+                 * so concurrent readers either see the complete previous file or the complete new one.
+                 */
+                template<typename T>
+                void write_precomputation(const std::string &path,
+                                          std::uint32_t kind,
+                                          std::uint64_t size,
+                                          std::uint64_t fingerprint,
+                                          const std::vector<precomputed_table<T>> &tables) {
+                    typedef precomputation_element<T> element;
+
+                    precomputation_header header;
+                    std::memset(&header, 0, sizeof(header));
+                    std::memcpy(header.magic, precomputation_magic, sizeof(header.magic));
+                    header.version = precomputation_version;
+                    header.byte_order = precomputation_byte_order;
+                    header.kind = kind;
+                    header.element_size = element::size;
+                    header.size = size;
+                    header.fingerprint = fingerprint;
+                    header.tables = tables.size();
+
+                    auto align = [](std::uint64_t offset) {
+                        return (offset + precomputation_alignment - 1) / precomputation_alignment *
+                               precomputation_alignment;
+                    };
+
+                    std::vector<std::uint64_t> directory(2 * tables.size());
+                    std::uint64_t offset = align(sizeof(header) + directory.size() * sizeof(std::uint64_t));
+                    for (std::size_t i = 0; i < tables.size(); i++) {
+                        directory[2 * i] = offset;
+                        directory[2 * i + 1] = tables[i].size();
+                        offset = align(offset + tables[i].size() * element::size);
+                    }
+
+                    const std::string temporary = path + ".tmp";
+                    {
+                        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+                        if (!out) {
+                            throw std::runtime_error("precomputation: cannot open " + temporary);
+                        }
+
+                        const char padding[precomputation_alignment] = {};
+                        std::uint64_t position = 0;
+                        auto write = [&](const void *bytes, std::uint64_t length) {
+                            out.write(static_cast<const char *>(bytes), length);
+                            position += length;
+                        };
+
+                        write(&header, sizeof(header));
+                        write(directory.data(), directory.size() * sizeof(std::uint64_t));
+                        std::vector<std::uint64_t> limbs;
+                        for (std::size_t i = 0; i < tables.size(); i++) {
+                            write(padding, directory[2 * i] - position);
+
+                            limbs.resize(tables[i].size() * element::limbs);
+                            for (std::size_t j = 0; j < tables[i].size(); j++) {
+                                element::write(tables[i][j], limbs.data() + j * element::limbs);
+                            }
+                            write(limbs.data(), limbs.size() * sizeof(std::uint64_t));
+                        }
+
+                        out.flush();
+                        if (!out) {
+                            throw std::runtime_error("precomputation: cannot write " + temporary);
+                        }
+                    }
+
+                    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+                        std::remove(temporary.c_str());
+                        throw std::runtime_error("precomputation: cannot rename " + temporary + " to " + path);
+                    }
+                }
+
+                /**
+                 * Read-only mapping of a precomputation file. Tables are decoded from the mapping into owned
+                 * storage, so they outlive it.
+                 */
+                class precomputation_file {
+                    struct mapping {
+                        const unsigned char *bytes = nullptr;
+                        std::size_t length = 0;
+                        std::vector<std::uint64_t> fallback;
+
+                        ~mapping() {
+#ifdef CRYPTO3_MATH_PRECOMPUTATION_MMAP
+                            if (fallback.empty() && bytes != nullptr) {
+                                ::munmap(const_cast<unsigned char *>(bytes), length);
+                            }
+#endif
+                        }
+                    };
+
+                public:
+                    explicit precomputation_file(const std::string &path) : region(std::make_shared<mapping>()) {
+#ifdef CRYPTO3_MATH_PRECOMPUTATION_MMAP
+                        const int fd = ::open(path.c_str(), O_RDONLY);
+                        if (fd < 0) {
+                            throw std::runtime_error("precomputation: cannot open " + path);
+                        }
+
+                        struct stat status;
+                        if (::fstat(fd, &status) != 0 || status.st_size <= 0) {
+                            ::close(fd);
+                            throw std::runtime_error("precomputation: cannot stat " + path);
+                        }
+
+                        void *bytes = ::mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                        ::close(fd);
+                        if (bytes == MAP_FAILED) {
+                            throw std::runtime_error("precomputation: cannot map " + path);
+                        }
+
+                        region->bytes = static_cast<const unsigned char *>(bytes);
+                        region->length = status.st_size;
+#else
+                        std::ifstream in(path, std::ios::binary | std::ios::ate);
+                        if (!in) {
+                            throw std::runtime_error("precomputation: cannot open " + path);
+                        }
+
+                        region->length = in.tellg();
+                        region->fallback.resize((region->length + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+                        in.seekg(0);
+                        in.read(reinterpret_cast<char *>(region->fallback.data()), region->length);
+                        if (!in) {
+                            throw std::runtime_error("precomputation: cannot read " + path);
+                        }
+                        region->bytes = reinterpret_cast<const unsigned char *>(region->fallback.data());
+#endif
+
+                        if (region->length < sizeof(precomputation_header)) {
+                            throw std::invalid_argument("precomputation: truncated header");
+                        }
+                        std::memcpy(&header, region->bytes, sizeof(header));
+
+                        if (std::memcmp(header.magic, precomputation_magic, sizeof(header.magic)) != 0) {
+                            throw std::invalid_argument("precomputation: unexpected magic");
+                        }
+                        if (header.version != precomputation_version) {
+                            throw std::invalid_argument("precomputation: unsupported version");
+                        }
+                        if (header.byte_order != precomputation_byte_order) {
+                            throw std::invalid_argument("precomputation: unexpected byte order");
+                        }
+                        if (region->length < sizeof(header) + 2 * header.tables * sizeof(std::uint64_t)) {
+                            throw std::invalid_argument("precomputation: truncated directory");
+                        }
+                    }
+
+                    std::uint32_t kind() const {
+                        return header.kind;
+                    }
+
+                    std::uint64_t size() const {
+                        return header.size;
+                    }
+
+                    std::uint64_t fingerprint() const {
+                        return header.fingerprint;
+                    }
+
+                    std::size_t tables() const {
+                        return header.tables;
+                    }
+
+                    /**
+                     * Decoded contents of table idx.
+                     */
+                    template<typename T>
+                    precomputed_table<T> table(std::size_t idx) const {
+                        typedef precomputation_element<T> element;
+
+                        if (header.element_size != element::size) {
+                            throw std::invalid_argument("precomputation: unexpected element size");
+                        }
+                        if (idx >= header.tables) {
+                            throw std::invalid_argument("precomputation: table index out of range");
+                        }
+
+                        std::uint64_t entry[2];
+                        std::memcpy(entry, region->bytes + sizeof(header) + 2 * idx * sizeof(std::uint64_t),
+                                    sizeof(entry));
+
+                        const std::uint64_t offset = entry[0];
+                        const std::uint64_t count = entry[1];
+                        if (offset > region->length || count > (region->length - offset) / element::size) {
+                            throw std::invalid_argument("precomputation: truncated table");
+                        }
+
+                        std::vector<T> values(count);
+                        const unsigned char *first = region->bytes + offset;
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                        for (std::size_t i = 0; i < count; i++) {
+                            std::uint64_t limbs[element::limbs];
+                            std::memcpy(limbs, first + i * element::size, element::size);
+                            values[i] = element::read(limbs);
+                        }
+                        return precomputed_table<T>(std::move(values));
+                    }
+
+                private:
+                    std::shared_ptr<mapping> region;
+                    precomputation_header header;
+                };
+            }    // namespace detail
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_DETAIL_PRECOMPUTATION_HPP
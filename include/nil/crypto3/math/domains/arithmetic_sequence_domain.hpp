@@ -26,11 +26,17 @@
 #ifndef CRYPTO3_MATH_ARITHMETIC_SEQUENCE_DOMAIN_HPP
 #define CRYPTO3_MATH_ARITHMETIC_SEQUENCE_DOMAIN_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
 #include <vector>
 
+#include <nil/crypto3/math/detail/precomputation.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 
 #include <nil/crypto3/math/polynomial/basis_change.hpp>
+#include <nil/crypto3/math/polynomial/shift.hpp>
 
 #ifdef MULTICORE
 #include <omp.h>
@@ -52,22 +58,85 @@ namespace nil {
             public:
                 typedef FieldType field_type;
 
-                bool precomputation_sentinel;
-                std::vector<std::vector<std::vector<value_type>>> subproduct_tree;
-                std::vector<value_type> arithmetic_sequence;
+                /*
+                 * Set with release semantics once every table is in place, so readers that observe it with
+                 * acquire semantics need no lock; precomputation_mutex only serializes the first computation.
+                 */
+                std::atomic<bool> precomputation_sentinel;
+                std::mutex precomputation_mutex;
+                math::subproduct_tree<FieldType> subproduct_tree;
+                detail::precomputed_table<value_type> arithmetic_sequence;
+                /*
+                 * Coefficients of the vanishing polynomial prod_{i < m} (x - a_i), lowest first. Only add_poly_z and
+                 * get_vanishing_polynomial_terms need them, so they are computed on first use, published through
+                 * vanishing_sentinel, and left out of precomputation files.
+                 */
+                std::atomic<bool> vanishing_sentinel;
+                detail::precomputed_table<value_type> vanishing_coefficients;
                 value_type arithmetic_generator;
 
+                /*
+                 * Tag of the domain in precomputation files, see save_precomputation.
+                 */
+                constexpr static const std::uint32_t precomputation_kind = 2;
+
                 void do_precomputation() {
                     compute_subproduct_tree<FieldType>(this->subproduct_tree, log2(this->m));
 
                     arithmetic_generator = value_type(fields::arithmetic_params<FieldType>::arithmetic_generator);
 
-                    arithmetic_sequence = std::vector<value_type>(this->m);
+                    std::vector<value_type> sequence(this->m);
                     for (std::size_t i = 0; i < this->m; i++) {
-                        arithmetic_sequence[i] = arithmetic_generator * value_type(i);
+                        sequence[i] = arithmetic_generator * value_type(i);
                     }
 
-                    precomputation_sentinel = true;
+                    arithmetic_sequence = std::move(sequence);
+
+                    precomputation_sentinel.store(true, std::memory_order_release);
+                }
+
+                /**
+                 * Store the precomputed state to path, computing it first if needed.
+                 */
+                void save_precomputation(const std::string &path) {
+                    precompute();
+
+                    detail::write_precomputation<value_type>(path, precomputation_kind, this->m,
+                                                             precomputation_fingerprint(),
+                                                             {subproduct_tree.storage(), arithmetic_sequence});
+                }
+
+                /**
+                 * Adopt the precomputed state stored in path by save_precomputation. The tables are decoded
+                 * from the file, nothing is recomputed.
+                 * The domain must not be precomputed yet, since other threads may already read its tables
+                 * without the lock; every table is validated before any of them is adopted.
+                 */
+                void load_precomputation(const std::string &path) {
+                    std::lock_guard<std::mutex> lock(precomputation_mutex);
+
+                    if (precomputation_sentinel.load(std::memory_order_relaxed)) {
+                        throw std::invalid_argument("arithmetic: domain is already precomputed");
+                    }
+
+                    const detail::precomputation_file file(path);
+                    if (file.kind() != precomputation_kind || file.size() != this->m ||
+                        file.fingerprint() != precomputation_fingerprint() || file.tables() != 2) {
+                        throw std::invalid_argument("arithmetic: precomputation does not match the domain");
+                    }
+
+                    detail::precomputed_table<value_type> sequence = file.table<value_type>(1);
+                    if (sequence.size() != this->m) {
+                        throw std::invalid_argument("arithmetic: precomputed table has unexpected size");
+                    }
+
+                    /* The tree is built on 2^log2(m) points, see compute_subproduct_tree; assign checks the size */
+                    const std::size_t points = std::size_t(1) << static_cast<std::size_t>(log2(this->m));
+                    subproduct_tree.assign(points, file.table<value_type>(0));
+                    arithmetic_sequence = std::move(sequence);
+                    arithmetic_generator = value_type(fields::arithmetic_params<FieldType>::arithmetic_generator);
+
+                    precomputation_sentinel.store(true, std::memory_order_release);
                 }
 
                 arithmetic_sequence_domain(const std::size_t m) : evaluation_domain<FieldType>(m) {
@@ -75,13 +144,48 @@ namespace nil {
                         throw std::invalid_argument("arithmetic(): expected m > 1");
                     }
 
-                    if (!(value_type(fields::arithmetic_params<FieldType>::arithmetic_generator).is_zero())) {
+                    /* The basis changes walk a subproduct tree built on 2^log2(m) points */
+                    if ((m & (m - 1)) != 0) {
+                        throw std::invalid_argument("arithmetic(): expected m to be a power of two");
+                    }
+
+                    if (value_type(fields::arithmetic_params<FieldType>::arithmetic_generator).is_zero()) {
                         throw std::invalid_argument(
                             "arithmetic(): expected arithmetic_params<FieldType>::arithmetic_generator.is_zero() "
                             "!= true");
                     }
 
-                    precomputation_sentinel = false;
+                    precomputation_sentinel.store(false, std::memory_order_relaxed);
+                    vanishing_sentinel.store(false, std::memory_order_relaxed);
+                }
+
+                /**
+                 * Compute the tables now instead of on first use. Safe to call concurrently: the tables are
+                 * computed exactly once, after which the domain is immutable and may be shared by all threads.
+                 */
+                void precompute() {
+                    if (!precomputation_sentinel.load(std::memory_order_acquire)) {
+                        std::lock_guard<std::mutex> lock(precomputation_mutex);
+                        if (!precomputation_sentinel.load(std::memory_order_relaxed)) {
+                            do_precomputation();
+                        }
+                    }
+                }
+
+                /**
+                 * Compute the vanishing polynomial coefficients now instead of on first use, with the same
+                 * guarantees as precompute.
+                 */
+                void precompute_vanishing() {
+                    if (!vanishing_sentinel.load(std::memory_order_acquire)) {
+                        precompute();
+
+                        std::lock_guard<std::mutex> lock(precomputation_mutex);
+                        if (!vanishing_sentinel.load(std::memory_order_relaxed)) {
+                            vanishing_coefficients = compute_vanishing_coefficients();
+                            vanishing_sentinel.store(true, std::memory_order_release);
+                        }
+                    }
                 }
 
                 void fft(std::vector<value_type> &a) {
@@ -93,15 +197,13 @@ namespace nil {
                         }
                     }
 
-                    if (!this->precomputation_sentinel) {
-                        do_precomputation();
-                    }
+                    precompute();
 
                     /* Monomial to Newton */
                     monomial_to_newton_basis<FieldType>(a, subproduct_tree, this->m);
 
                     /* Newton to Evaluation */
-                    std::vector<value_type> S(this->m); /* i! * arithmetic_generator */
+                    detail::scratch_vector<value_type> S(this->m); /* i! * arithmetic_generator */
                     S[0] = value_type::one();
 
                     value_type factorial = value_type::one();
@@ -110,8 +212,10 @@ namespace nil {
                         S[i] = (factorial * arithmetic_generator).inversed();
                     }
 
-                    multiplication(a, a, S);
-                    a.resize(this->m);
+                    /* Only the low m coefficients of the product are kept */
+                    detail::scratch_vector<value_type> product(2 * this->m - 1, value_type::zero());
+                    detail::multiply_add(product.data(), a.data(), this->m, S.data(), this->m);
+                    std::copy(product.begin(), product.begin() + this->m, a.begin());
 
 #ifdef MULTICORE
 #pragma omp parallel for
@@ -130,14 +234,13 @@ namespace nil {
                         }
                     }
 
-                    if (!this->precomputation_sentinel)
-                        do_precomputation();
+                    precompute();
 
                     /* Interpolation to Newton */
-                    std::vector<value_type> S(this->m); /* i! * arithmetic_generator */
+                    detail::scratch_vector<value_type> S(this->m); /* i! * arithmetic_generator */
                     S[0] = value_type::one();
 
-                    std::vector<value_type> W(this->m);
+                    detail::scratch_vector<value_type> W(this->m);
                     W[0] = a[0] * S[0];
 
                     value_type factorial = value_type::one();
@@ -149,8 +252,9 @@ namespace nil {
                             S[i] = -S[i];
                     }
 
-                    multiplication(a, W, S);
-                    a.resize(this->m);
+                    detail::scratch_vector<value_type> product(2 * this->m - 1, value_type::zero());
+                    detail::multiply_add(product.data(), W.data(), this->m, S.data(), this->m);
+                    std::copy(product.begin(), product.begin() + this->m, a.begin());
 
                     /* Newton to Monomial */
                     newton_to_monomial_basis<FieldType>(a, subproduct_tree, this->m);
@@ -161,8 +265,7 @@ namespace nil {
                     /* Evaluate for x = t */
                     /* Return coeffs for each l_j(x) = (l / l_i[j]) * w[j] */
 
-                    if (!precomputation_sentinel)
-                        do_precomputation();
+                    precompute();
 
                     /**
                      * If t equals one of the arithmetic progression values,
@@ -206,14 +309,12 @@ namespace nil {
                     return l;
                 }
                 value_type get_domain_element(const std::size_t idx) {
-                    if (!this->precomputation_sentinel)
-                        do_precomputation();
+                    precompute();
 
                     return this->arithmetic_sequence[idx];
                 }
                 value_type compute_vanishing_polynomial(const value_type &t) {
-                    if (!this->precomputation_sentinel)
-                        do_precomputation();
+                    precompute();
 
                     /* Notes: Z = prod_{i = 0 to m} (t - a[i]) */
                     value_type Z = value_type::one();
@@ -226,29 +327,26 @@ namespace nil {
                     if (H.size() != this->m + 1)
                         throw std::invalid_argument("arithmetic: expected H.size() == this->m+1");
 
-                    if (!this->precomputation_sentinel)
-                        do_precomputation();
-
-                    std::vector<value_type> x(2, value_type::zero());
-                    x[0] = -this->arithmetic_sequence[0];
-                    x[1] = value_type::one();
-
-                    std::vector<value_type> t(2, value_type::zero());
-
-                    for (std::size_t i = 1; i < this->m + 1; i++) {
-                        t[0] = -this->arithmetic_sequence[i];
-                        t[1] = value_type::one();
-
-                        multiplication(x, x, t);
-                    }
+                    precompute_vanishing();
 
 #ifdef MULTICORE
 #pragma omp parallel for
 #endif
                     for (std::size_t i = 0; i < this->m + 1; i++) {
-                        H[i] += (x[i] * coeff);
+                        H[i] += (vanishing_coefficients[i] * coeff);
                     }
                 }
+                std::vector<std::pair<std::size_t, value_type>> get_vanishing_polynomial_terms() {
+                    precompute_vanishing();
+
+                    std::vector<std::pair<std::size_t, value_type>> terms;
+                    for (std::size_t i = 0; i < this->m + 1; i++) {
+                        if (!vanishing_coefficients[i].is_zero()) {
+                            terms.emplace_back(i, vanishing_coefficients[i]);
+                        }
+                    }
+                    return terms;
+                }
                 void divide_by_z_on_coset(std::vector<value_type> &P) {
                     const value_type coset = this->arithmetic_generator; /* coset in arithmetic sequence? */
                     const value_type Z_inverse_at_coset = this->compute_vanishing_polynomial(coset).inversed();
@@ -256,6 +354,26 @@ namespace nil {
                         P[i] *= Z_inverse_at_coset;
                     }
                 }
+
+            private:
+                /*
+                 * prod_{i < m} (x - a_i) by doubling, m being a power of two: with P_k the product over the first k
+                 * points, the product over the next k is P_k(x - a_k), a Taylor shift. O(M(m)) in total.
+                 */
+                std::vector<value_type> compute_vanishing_coefficients() const {
+                    polynomial<value_type> vanishing = {-arithmetic_sequence[0], value_type::one()};
+                    for (std::size_t points = 1; points < this->m; points *= 2) {
+                        const value_type a = arithmetic_sequence[points];
+                        vanishing = vanishing * polynomial_taylor_shift<FieldType>(vanishing, -a);
+                    }
+                    return std::vector<value_type>(vanishing.begin(), vanishing.end());
+                }
+
+                std::uint64_t precomputation_fingerprint() const {
+                    return detail::precomputation_fingerprint<value_type>(
+                        {value_type::one(), -value_type::one(),
+                         value_type(fields::arithmetic_params<FieldType>::arithmetic_generator)});
+                }
             };
         }    // namespace math
     }        // namespace crypto3
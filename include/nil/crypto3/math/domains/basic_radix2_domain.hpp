@@ -115,6 +115,9 @@ namespace nil {
                     H[0] -= coeff;
                 }
 
+                std::vector<std::pair<std::size_t, value_type>> get_vanishing_polynomial_terms() {
+                    return {{0, -value_type::one()}, {this->m, value_type::one()}};
+                }
                 void divide_by_z_on_coset(std::vector<value_type> &P) {
                     const value_type coset = fields::arithmetic_params<FieldType>::multiplicative_generator;
                     const value_type Z_inverse_at_coset = this->compute_vanishing_polynomial(coset).inversed();
@@ -36,6 +36,7 @@
 #include <nil/crypto3/algebra/type_traits.hpp>
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/arena.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
 
 #ifdef MULTICORE
@@ -92,6 +93,113 @@ namespace nil {
                     }
                 }
 
+                /*
+                 * Transforms and butterfly runs of at most this many elements are not split into further tasks.
+                 */
+                constexpr static const std::size_t radix2_task_grain = 1ul << 12;
+
+                /*
+                 * Decimation in frequency, leaving the result in bit-reversed order. Under MULTICORE the
+                 * butterflies of a stage and the two halves of the recursion are OpenMP tasks.
+                 */
+                template<typename FieldType>
+                void radix2_dif_tasks(typename FieldType::value_type *a,
+                                      const std::size_t n,
+                                      const typename FieldType::value_type &omega) {
+                    typedef typename FieldType::value_type value_type;
+
+                    if (n <= radix2_task_grain) {
+                        value_type w_len = omega;
+                        for (std::size_t len = n; len >= 2; len >>= 1) {
+                            const std::size_t half = len / 2;
+                            for (std::size_t k = 0; k < n; k += len) {
+                                value_type w = value_type::one();
+                                for (std::size_t j = 0; j < half; ++j) {
+                                    const value_type u = a[k + j];
+                                    const value_type v = a[k + j + half];
+                                    a[k + j] = u + v;
+                                    a[k + j + half] = (u - v) * w;
+                                    w *= w_len;
+                                }
+                            }
+                            w_len = w_len.squared();
+                        }
+                        return;
+                    }
+
+                    const std::size_t half = n / 2;
+
+#ifdef MULTICORE
+#pragma omp taskloop
+#endif
+                    for (std::size_t start = 0; start < half; start += radix2_task_grain) {
+                        value_type w = omega.pow(start);
+                        for (std::size_t j = start; j < std::min(start + radix2_task_grain, half); ++j) {
+                            const value_type u = a[j];
+                            const value_type v = a[j + half];
+                            a[j] = u + v;
+                            a[j + half] = (u - v) * w;
+                            w *= omega;
+                        }
+                    }
+
+                    const value_type omega_squared = omega.squared();
+
+#ifdef MULTICORE
+#pragma omp task
+#endif
+                    radix2_dif_tasks<FieldType>(a, half, omega_squared);
+#ifdef MULTICORE
+#pragma omp task
+#endif
+                    radix2_dif_tasks<FieldType>(a + half, half, omega_squared);
+#ifdef MULTICORE
+#pragma omp taskwait
+#endif
+                }
+
+                /*
+                 * Radix-2 FFT made of OpenMP tasks, with the same result as basic_serial_radix2_fft. Inside a
+                 * parallel region several transforms may run at once: idle threads of the team take over pending
+                 * tasks of whichever transform still has work, so transforms of different sizes balance.
+                 * Outside a parallel region it opens one.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_task_radix2_fft(Range &a, const typename FieldType::value_type &omega) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+                    BOOST_STATIC_ASSERT(std::is_same<typename FieldType::value_type, value_type>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+
+#ifdef MULTICORE
+                    if (omp_get_level() == 0) {
+#pragma omp parallel
+#pragma omp single
+                        basic_task_radix2_fft<FieldType>(a, omega);
+                        return;
+                    }
+#endif
+
+                    value_type *data = &a[0];
+                    radix2_dif_tasks<FieldType>(data, n, omega);
+
+#ifdef MULTICORE
+#pragma omp taskloop
+#endif
+                    for (std::size_t start = 0; start < n; start += radix2_task_grain) {
+                        for (std::size_t k = start; k < std::min(start + radix2_task_grain, n); ++k) {
+                            const std::size_t rk = bitreverse(k, logn);
+                            if (k < rk)
+                                std::swap(data[k], data[rk]);
+                        }
+                    }
+                }
+
                 template<typename FieldType, typename Range>
                 void basic_parallel_radix2_fft_inner(Range &a,
                                                      const typename FieldType::value_type &omega,
@@ -114,7 +222,7 @@ namespace nil {
                         return;
                     }
 
-                    std::vector<std::vector<value_type>> tmp(num_cpus);
+                    scratch_vector<scratch_vector<value_type>> tmp(num_cpus);
                     for (std::size_t j = 0; j < num_cpus; ++j) {
                         tmp[j].resize(1ul << (log_m - log_cpus), value_type::zero());
                     }
@@ -173,7 +281,7 @@ namespace nil {
                     if (log_cpus == 0) {
                         basic_serial_radix2_fft<FieldType>(a, omega);
                     } else {
-                        basic_parallel_radix2_fft_inner(a, omega, log_cpus);
+                        basic_parallel_radix2_fft_inner<FieldType>(a, omega, log_cpus);
                     }
                 }
 
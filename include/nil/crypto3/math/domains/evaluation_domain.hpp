@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_MATH_EVALUATION_DOMAIN_HPP
 #define CRYPTO3_MATH_EVALUATION_DOMAIN_HPP
 
+#include <utility>
 #include <vector>
 
 #include <nil/crypto3/multiprecision/integer.hpp>
@@ -63,6 +64,13 @@ namespace nil {
                  */
                 evaluation_domain(const std::size_t m) : m(m), log2_size(multiprecision::msb(m)) {};
 
+                /**
+                 * Compute any lazily precomputed tables of S now, e.g. to warm up a domain before sharing it
+                 * between threads. Domains without such tables do nothing.
+                 */
+                virtual void precompute() {
+                }
+
                 /**
                  * Get the idx-th element in S.
                  */
@@ -99,6 +107,24 @@ namespace nil {
                  */
                 virtual void add_poly_z(const value_type &coeff, std::vector<value_type> &H) = 0;
 
+                /**
+                 * Get the nonzero terms (power, coefficient) of the vanishing polynomial of S, lowest power first.
+                 * The default expands it densely through add_poly_z; domains whose vanishing polynomial has few
+                 * terms or is precomputed override it. See get_vanishing_polynomial in sparse_polynomial.hpp.
+                 */
+                virtual std::vector<std::pair<std::size_t, value_type>> get_vanishing_polynomial_terms() {
+                    std::vector<value_type> H(m + 1, value_type::zero());
+                    add_poly_z(value_type::one(), H);
+
+                    std::vector<std::pair<std::size_t, value_type>> terms;
+                    for (std::size_t i = 0; i <= m; i++) {
+                        if (!H[i].is_zero()) {
+                            terms.emplace_back(i, H[i]);
+                        }
+                    }
+                    return terms;
+                }
+
                 /**
                  * Multiply by the evaluation, on a coset of S, of the inverse of the vanishing polynomial of S.
                  */
@@ -26,12 +26,17 @@
 #ifndef CRYPTO3_MATH_EXTENDED_RADIX2_DOMAIN_HPP
 #define CRYPTO3_MATH_EXTENDED_RADIX2_DOMAIN_HPP
 
+#include <algorithm>
 #include <vector>
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 namespace nil {
     namespace crypto3 {
         namespace math {
@@ -41,6 +46,15 @@ namespace nil {
             template<typename FieldType>
             class evaluation_domain;
 
+            /*
+             * The domain is the union of 2^k cosets shift^j * H, j < 2^k, of the subgroup H of order small_m = m / 2^k.
+             * The element with index j * small_m + i is shift^j * omega^i, so for k = 1 the first half is H and
+             * the second half is shift * H. With z = shift^small_m the vanishing polynomial is
+             * prod_{j} (x^small_m - z^j), and a polynomial reduced modulo x^small_m - z^j is a linear combination of
+             * its small_m-sized blocks with coefficients z^{j t}. The forward transform forms these combinations and
+             * runs one FFT per coset; the inverse undoes the FFTs and solves the Vandermonde system in the z^j,
+             * whose inverse is precomputed. Both cost O(m log small_m + m * 2^k).
+             */
             template<typename FieldType>
             class extended_radix2_domain : public evaluation_domain<FieldType> {
                 typedef typename FieldType::value_type value_type;
@@ -48,26 +62,97 @@ namespace nil {
             public:
                 typedef FieldType field_type;
 
+                /*
+                 * Combining the cosets costs 2^k multiplications per element, so beyond this many cosets the
+                 * sequence domains are preferred, see detail::is_extended_radix2_domain.
+                 */
+                constexpr static const std::size_t max_cosets_log = 5;
+
                 std::size_t small_m;
+                std::size_t cosets;
                 value_type omega;
                 value_type shift;
 
+                /* shift^j, j < cosets */
+                std::vector<value_type> coset_shifts;
+                /* z^{j t} at j * cosets + t */
+                std::vector<value_type> coset_powers;
+                /* Coefficient t of the Lagrange polynomial of z^j over {z^l}, at j * cosets + t */
+                std::vector<value_type> coset_lagrange;
+                /* Coefficients of prod_{j} (T - z^j), so Z(x) = sum_t vanishing_coefficients[t] * x^{t * small_m} */
+                std::vector<value_type> vanishing_coefficients;
+
                 extended_radix2_domain(const std::size_t m) : evaluation_domain<FieldType>(m) {
                     if (m <= 1)
                         throw std::invalid_argument("extended_radix2(): expected m > 1");
 
+                    std::size_t cosets_log = 1;
                     if (!std::is_same<value_type, std::complex<double>>::value) {
                         const std::size_t logm = static_cast<std::size_t>(std::ceil(std::log2(m)));
-                        if (logm != (fields::arithmetic_params<FieldType>::s + 1))
+                        if (logm <= fields::arithmetic_params<FieldType>::s)
                             throw std::invalid_argument(
-                                "extended_radix2(): expected logm == fields::arithmetic_params<FieldType>::s + 1");
+                                "extended_radix2(): expected logm > fields::arithmetic_params<FieldType>::s");
+                        cosets_log = logm - fields::arithmetic_params<FieldType>::s;
                     }
 
-                    small_m = m / 2;
+                    cosets = std::size_t(1) << cosets_log;
+                    small_m = m >> cosets_log;
+                    if (small_m * cosets != m)
+                        throw std::invalid_argument("extended_radix2(): expected m to be a power of two");
 
                     omega = unity_root<FieldType>(small_m);
 
                     shift = detail::coset_shift<FieldType>();
+
+                    const value_type shift_to_small_m = shift.pow(small_m);
+
+                    coset_shifts.assign(cosets, value_type::one());
+                    std::vector<value_type> z(cosets, value_type::one());
+                    for (std::size_t j = 1; j < cosets; ++j) {
+                        coset_shifts[j] = coset_shifts[j - 1] * shift;
+                        z[j] = z[j - 1] * shift_to_small_m;
+                        if (z[j] == value_type::one())
+                            throw std::invalid_argument("extended_radix2(): expected disjoint cosets");
+                    }
+
+                    coset_powers.assign(cosets * cosets, value_type::one());
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        for (std::size_t t = 1; t < cosets; ++t) {
+                            coset_powers[j * cosets + t] = coset_powers[j * cosets + t - 1] * z[j];
+                        }
+                    }
+
+                    vanishing_coefficients.assign(cosets + 1, value_type::zero());
+                    vanishing_coefficients[0] = value_type::one();
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        for (std::size_t t = j + 1; t > 0; --t) {
+                            vanishing_coefficients[t] =
+                                vanishing_coefficients[t - 1] - z[j] * vanishing_coefficients[t];
+                        }
+                        vanishing_coefficients[0] = -z[j] * vanishing_coefficients[0];
+                    }
+
+                    /* L_j = (Z / (T - z^j)) / prod_{l != j} (z^j - z^l), the quotient by synthetic division */
+                    coset_lagrange.assign(cosets * cosets, value_type::zero());
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        value_type *q = coset_lagrange.data() + j * cosets;
+                        q[cosets - 1] = vanishing_coefficients[cosets];
+                        for (std::size_t t = cosets - 1; t > 0; --t) {
+                            q[t - 1] = vanishing_coefficients[t] + z[j] * q[t];
+                        }
+
+                        value_type denominator = value_type::one();
+                        for (std::size_t l = 0; l < cosets; ++l) {
+                            if (l != j) {
+                                denominator *= z[j] - z[l];
+                            }
+                        }
+
+                        const value_type denominator_inverse = denominator.inversed();
+                        for (std::size_t t = 0; t < cosets; ++t) {
+                            q[t] *= denominator_inverse;
+                        }
+                    }
                 }
 
                 void fft(std::vector<value_type> &a) {
@@ -79,25 +164,30 @@ namespace nil {
                         }
                     }
 
-                    std::vector<value_type> a0(small_m, value_type::zero());
-                    std::vector<value_type> a1(small_m, value_type::zero());
+                    detail::scratch_vector<detail::scratch_vector<value_type>> b(
+                        cosets, detail::scratch_vector<value_type>(small_m));
 
-                    const value_type shift_to_small_m = shift.pow(small_m);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        const value_type *powers = coset_powers.data() + j * cosets;
 
-                    value_type shift_i = value_type::one();
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        a0[i] = a[i] + a[small_m + i];
-                        a1[i] = shift_i * (a[i] + shift_to_small_m * a[small_m + i]);
+                        value_type shift_i = value_type::one();
+                        for (std::size_t i = 0; i < small_m; ++i) {
+                            value_type sum = a[i];
+                            for (std::size_t t = 1; t < cosets; ++t) {
+                                sum += powers[t] * a[t * small_m + i];
+                            }
+                            b[j][i] = shift_i * sum;
 
-                        shift_i *= shift;
+                            shift_i *= coset_shifts[j];
+                        }
                     }
 
-                    _basic_radix2_fft<FieldType>(a0, omega);
-                    _basic_radix2_fft<FieldType>(a1, omega);
-
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        a[i] = a0[i];
-                        a[i + small_m] = a1[i];
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        _basic_radix2_fft<FieldType>(b[j], omega);
+                        std::copy(b[j].begin(), b[j].end(), a.begin() + j * small_m);
                     }
                 }
 
@@ -111,89 +201,107 @@ namespace nil {
                     }
 
                     // note: this is not in-place
-                    std::vector<value_type> a0(a.begin(), a.begin() + small_m);
-                    std::vector<value_type> a1(a.begin() + small_m, a.end());
+                    detail::scratch_vector<detail::scratch_vector<value_type>> b(cosets);
 
                     const value_type omega_inverse = omega.inversed();
-                    _basic_radix2_fft<FieldType>(a0, omega_inverse);
-                    _basic_radix2_fft<FieldType>(a1, omega_inverse);
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        b[j].assign(a.begin() + j * small_m, a.begin() + (j + 1) * small_m);
+                        _basic_radix2_fft<FieldType>(b[j], omega_inverse);
+                    }
 
-                    const value_type shift_to_small_m = shift.pow(small_m);
-                    const value_type sconst = (value_type(small_m) * (value_type::one() - shift_to_small_m)).inversed();
+                    const value_type small_m_inverse = value_type(small_m).inversed();
 
-                    const value_type shift_inverse = shift.inversed();
-                    value_type shift_inverse_i = value_type::one();
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        const value_type shift_inverse = coset_shifts[j].inversed();
 
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        a[i] = sconst * (-shift_to_small_m * a0[i] + shift_inverse_i * a1[i]);
-                        a[i + small_m] = sconst * (a0[i] - shift_inverse_i * a1[i]);
+                        value_type shift_inverse_i = small_m_inverse;
+                        for (std::size_t i = 0; i < small_m; ++i) {
+                            b[j][i] *= shift_inverse_i;
+                            shift_inverse_i *= shift_inverse;
+                        }
+                    }
 
-                        shift_inverse_i *= shift_inverse;
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t i = 0; i < small_m; ++i) {
+                        for (std::size_t t = 0; t < cosets; ++t) {
+                            value_type sum = value_type::zero();
+                            for (std::size_t j = 0; j < cosets; ++j) {
+                                sum += coset_lagrange[j * cosets + t] * b[j][i];
+                            }
+                            a[t * small_m + i] = sum;
+                        }
                     }
                 }
 
                 std::vector<value_type> evaluate_all_lagrange_polynomials(const value_type &t) {
-                    const std::vector<value_type> T0 =
-                        detail::basic_radix2_evaluate_all_lagrange_polynomials<FieldType>(small_m, t);
-                    const std::vector<value_type> T1 =
-                        detail::basic_radix2_evaluate_all_lagrange_polynomials<FieldType>(small_m,
-                                                                                          t * shift.inversed());
-
                     std::vector<value_type> result(this->m, value_type::zero());
 
                     const value_type t_to_small_m = t.pow(small_m);
-                    const value_type shift_to_small_m = shift.pow(small_m);
-                    const value_type one_over_denom = (shift_to_small_m - value_type::one()).inversed();
-                    const value_type T0_coeff = (t_to_small_m - shift_to_small_m) * (-one_over_denom);
-                    const value_type T1_coeff = (t_to_small_m - value_type::one()) * one_over_denom;
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        result[i] = T0[i] * T0_coeff;
-                        result[i + small_m] = T1[i] * T1_coeff;
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        const std::vector<value_type> T =
+                            detail::basic_radix2_evaluate_all_lagrange_polynomials<FieldType>(
+                                small_m, t * coset_shifts[j].inversed());
+
+                        /* prod_{l != j} (t^small_m - z^l) / (z^j - z^l), the Lagrange polynomial of z^j */
+                        value_type coeff = value_type::zero();
+                        for (std::size_t l = cosets; l > 0; --l) {
+                            coeff = coeff * t_to_small_m + coset_lagrange[j * cosets + l - 1];
+                        }
+
+                        for (std::size_t i = 0; i < small_m; ++i) {
+                            result[j * small_m + i] = T[i] * coeff;
+                        }
                     }
 
                     return result;
                 }
 
                 value_type get_domain_element(const std::size_t idx) {
-                    if (idx < small_m) {
-                        return omega.pow(idx);
-                    } else {
-                        return shift * (omega.pow(idx - small_m));
-                    }
+                    return coset_shifts[idx / small_m] * omega.pow(idx % small_m);
                 }
 
                 value_type compute_vanishing_polynomial(const value_type &t) {
-                    return (t.pow(small_m) - value_type::one()) * (t.pow(small_m) - shift.pow(small_m));
+                    const value_type t_to_small_m = t.pow(small_m);
+
+                    value_type Z = value_type::zero();
+                    for (std::size_t l = cosets + 1; l > 0; --l) {
+                        Z = Z * t_to_small_m + vanishing_coefficients[l - 1];
+                    }
+                    return Z;
                 }
 
                 void add_poly_z(const value_type &coeff, std::vector<value_type> &H) {
                     // if (H.size() != this->m + 1)
                     //    throw std::invalid_argument("extended_radix2: expected H.size() == this->m+1");
 
-                    const value_type shift_to_small_m = shift.pow(small_m);
-
-                    H[this->m] += coeff;
-                    H[small_m] -= coeff * (shift_to_small_m + value_type::one());
-                    H[0] += coeff * shift_to_small_m;
+                    for (std::size_t t = 0; t <= cosets; ++t) {
+                        H[t * small_m] += coeff * vanishing_coefficients[t];
+                    }
                 }
 
+                std::vector<std::pair<std::size_t, value_type>> get_vanishing_polynomial_terms() {
+                    std::vector<std::pair<std::size_t, value_type>> terms;
+                    for (std::size_t t = 0; t <= cosets; ++t) {
+                        if (!vanishing_coefficients[t].is_zero()) {
+                            terms.emplace_back(t * small_m, vanishing_coefficients[t]);
+                        }
+                    }
+                    return terms;
+                }
                 void divide_by_z_on_coset(std::vector<value_type> &P) {
                     const value_type coset = fields::arithmetic_params<FieldType>::multiplicative_generator;
 
-                    const value_type coset_to_small_m = coset.pow(small_m);
-                    const value_type shift_to_small_m = shift.pow(small_m);
-
-                    const value_type Z0 =
-                        (coset_to_small_m - value_type::one()) * (coset_to_small_m - shift_to_small_m);
-                    const value_type Z1 = (coset_to_small_m * shift_to_small_m - value_type::one()) *
-                                          (coset_to_small_m * shift_to_small_m - shift_to_small_m);
+                    for (std::size_t j = 0; j < cosets; ++j) {
+                        const value_type Z_inverse = compute_vanishing_polynomial(coset * coset_shifts[j]).inversed();
 
-                    const value_type Z0_inverse = Z0.inversed();
-                    const value_type Z1_inverse = Z1.inversed();
-
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        P[i] *= Z0_inverse;
-                        P[i + small_m] *= Z1_inverse;
+                        for (std::size_t i = 0; i < small_m; ++i) {
+                            P[j * small_m + i] *= Z_inverse;
+                        }
                     }
                 }
             };
@@ -26,9 +26,17 @@
 #ifndef CRYPTO3_MATH_GEOMETRIC_SEQUENCE_DOMAIN_HPP
 #define CRYPTO3_MATH_GEOMETRIC_SEQUENCE_DOMAIN_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
 #include <vector>
 
+#include <nil/crypto3/math/detail/precomputation.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
 
 #include <nil/crypto3/math/polynomial/basis_change.hpp>
 
@@ -52,25 +60,228 @@ namespace nil {
             public:
                 typedef FieldType field_type;
 
-                bool precomputation_sentinel;
-                std::vector<value_type> geometric_sequence;
-                std::vector<value_type> geometric_triangular_sequence;
+                /*
+                 * Set with release semantics once every table is in place, so readers that observe it with
+                 * acquire semantics need no lock; precomputation_mutex only serializes the first computation.
+                 */
+                std::atomic<bool> precomputation_sentinel;
+                std::mutex precomputation_mutex;
+                detail::precomputed_table<value_type> geometric_sequence;
+                detail::precomputed_table<value_type> geometric_triangular_sequence;
+                detail::precomputed_table<value_type> geometric_triangular_sequence_inverse;
+
+                /*
+                 * Input-independent parts of the basis changes, see
+                 * [Bostan & Schost 2005. Polynomial Evaluation and Interpolation on Special Sets of Points] on page 26.
+                 * With u_i = prod_{j = 1 to i} a_j / (1 - a_j), T_i = prod_{j = 1 to i} 1 / (a_j - 1) and s_i = (-1)^i:
+                 * - monomial_to_newton_scale_i = s_i * geometric_triangular_sequence_i / u_i
+                 * - newton_to_monomial_scale_i = s_i / u_i
+                 * - newton_to_evaluation_scale_i = s_i * u_i
+                 * - basis_change_z_i = s_i * u_i / geometric_triangular_sequence_i
+                 * The *_fft vectors are FFT images of size transform_size used by transformed_multiplication.
+                 */
+                std::size_t transform_size;
+                detail::precomputed_table<value_type> monomial_to_newton_scale;
+                detail::precomputed_table<value_type> newton_to_monomial_scale;
+                detail::precomputed_table<value_type> newton_to_evaluation_scale;
+                detail::precomputed_table<value_type> basis_change_z;
+                detail::precomputed_table<value_type> newton_to_evaluation;
+                detail::precomputed_table<value_type> newton_to_evaluation_inverse;
+                detail::precomputed_table<value_type> basis_change_z_reversed_fft;
+                detail::precomputed_table<value_type> basis_change_u_reversed_fft;
+                detail::precomputed_table<value_type> newton_to_evaluation_fft;
+                detail::precomputed_table<value_type> interpolation_to_newton_fft;
+                detail::precomputed_table<value_type> lagrange_weights;
+                /*
+                 * Coefficients of the vanishing polynomial prod_{i < m} (x - a_i), lowest first. Only add_poly_z and
+                 * get_vanishing_polynomial_terms need them, so they are computed on first use, published through
+                 * vanishing_sentinel, and left out of precomputation files.
+                 */
+                std::atomic<bool> vanishing_sentinel;
+                detail::precomputed_table<value_type> vanishing_coefficients;
+
+                /*
+                 * Tag of the domain in precomputation files, see save_precomputation.
+                 */
+                constexpr static const std::uint32_t precomputation_kind = 1;
 
                 void do_precomputation() {
-                    geometric_sequence = std::vector<value_type>(this->m, value_type::zero());
-                    geometric_sequence[0] = value_type::one();
+                    const value_type generator = fields::arithmetic_params<FieldType>::geometric_generator;
+                    const value_type generator_inverse = generator.inversed();
 
-                    geometric_triangular_sequence = std::vector<value_type>(this->m, value_type::zero());
-                    geometric_triangular_sequence[0] = value_type::one();
+                    std::vector<value_type> sequence(this->m, value_type::zero());
+                    sequence[0] = value_type::one();
 
+                    std::vector<value_type> triangular(this->m, value_type::zero());
+                    triangular[0] = value_type::one();
+
+                    std::vector<value_type> triangular_inverse(this->m, value_type::zero());
+                    triangular_inverse[0] = value_type::one();
+
+                    value_type geometric_sequence_inverse = value_type::one();
+                    for (std::size_t i = 1; i < this->m; i++) {
+                        sequence[i] = sequence[i - 1] * generator;
+                        triangular[i] = triangular[i - 1] * sequence[i - 1];
+                        triangular_inverse[i] = triangular_inverse[i - 1] * geometric_sequence_inverse;
+                        geometric_sequence_inverse *= generator_inverse;
+                    }
+
+                    /* (1 - a_i)^{-1}, the only inversions the basis changes need */
+                    std::vector<value_type> one_minus_inverse(this->m, value_type::zero());
                     for (std::size_t i = 1; i < this->m; i++) {
-                        geometric_sequence[i] =
-                            geometric_sequence[i - 1] * fields::arithmetic_params<FieldType>::geometric_generator;
-                        geometric_triangular_sequence[i] =
-                            geometric_triangular_sequence[i - 1] * geometric_sequence[i - 1];
+                        one_minus_inverse[i] = (value_type::one() - sequence[i]).inversed();
+                    }
+
+                    std::vector<value_type> u(this->m, value_type::one());
+                    std::vector<value_type> u_inverse(this->m, value_type::one());
+                    std::vector<value_type> to_evaluation(this->m, value_type::one());
+                    std::vector<value_type> to_evaluation_inverse(this->m, value_type::one());
+
+                    geometric_sequence_inverse = value_type::one();
+                    for (std::size_t i = 1; i < this->m; i++) {
+                        geometric_sequence_inverse *= generator_inverse;
+
+                        u[i] = u[i - 1] * sequence[i] * one_minus_inverse[i];
+                        u_inverse[i] =
+                            u_inverse[i - 1] * (value_type::one() - sequence[i]) * geometric_sequence_inverse;
+                        to_evaluation[i] = -to_evaluation[i - 1] * one_minus_inverse[i];
+                        to_evaluation_inverse[i] = to_evaluation_inverse[i - 1] * (sequence[i] - value_type::one());
+                    }
+
+                    std::vector<value_type> to_newton_scale(this->m);
+                    std::vector<value_type> to_monomial_scale(this->m);
+                    std::vector<value_type> to_evaluation_scale(this->m);
+                    std::vector<value_type> z(this->m);
+
+                    std::vector<value_type> interpolation_to_newton(this->m);
+                    for (std::size_t i = 0; i < this->m; i++) {
+                        to_newton_scale[i] = triangular[i] * u_inverse[i];
+                        to_monomial_scale[i] = u_inverse[i];
+                        to_evaluation_scale[i] = u[i];
+                        z[i] = u[i] * triangular_inverse[i];
+                        interpolation_to_newton[i] = triangular[i] * to_evaluation[i];
+
+                        if (i % 2 == 1) {
+                            to_newton_scale[i] = -to_newton_scale[i];
+                            to_monomial_scale[i] = -to_monomial_scale[i];
+                            to_evaluation_scale[i] = -to_evaluation_scale[i];
+                            z[i] = -z[i];
+                            interpolation_to_newton[i] = -interpolation_to_newton[i];
+                        }
                     }
 
-                    precomputation_sentinel = true;
+                    /* Products of two size-m operands, so 2m - 1 coefficients have to fit without wrapping */
+                    transform_size = detail::power_of_two(2 * this->m - 1);
+                    const value_type omega = unity_root<FieldType>(transform_size);
+
+                    std::vector<value_type> z_reversed_fft(z.rbegin(), z.rend());
+                    std::vector<value_type> u_reversed_fft(u.rbegin(), u.rend());
+                    std::vector<value_type> to_evaluation_fft = to_evaluation;
+                    std::vector<value_type> to_newton_fft = interpolation_to_newton;
+
+                    for (std::vector<value_type> *image :
+                         {&z_reversed_fft, &u_reversed_fft, &to_evaluation_fft, &to_newton_fft}) {
+                        image->resize(transform_size, value_type::zero());
+                        _basic_radix2_fft<FieldType>(*image, omega);
+                    }
+
+                    /* Barycentric weights: L_i(t) = lagrange_weights_i * prod_j (t - a_j) / (t - a_i) */
+                    value_type g_vanish = value_type::one();
+                    for (std::size_t i = 1; i < this->m; i++) {
+                        g_vanish *= value_type::one() - sequence[i];
+                    }
+
+                    const value_type r = sequence[this->m - 1].inversed();
+                    value_type r_i = value_type::one();
+
+                    std::vector<value_type> weights(this->m);
+                    value_type g_i = g_vanish.inversed();
+                    weights[0] = g_i;
+                    for (std::size_t i = 1; i < this->m; i++) {
+                        g_i *= (value_type::one() - sequence[this->m - i]) * -one_minus_inverse[i] * sequence[i];
+                        r_i *= r;
+                        weights[i] = r_i * g_i;
+                    }
+
+                    geometric_sequence = std::move(sequence);
+                    geometric_triangular_sequence = std::move(triangular);
+                    geometric_triangular_sequence_inverse = std::move(triangular_inverse);
+                    monomial_to_newton_scale = std::move(to_newton_scale);
+                    newton_to_monomial_scale = std::move(to_monomial_scale);
+                    newton_to_evaluation_scale = std::move(to_evaluation_scale);
+                    basis_change_z = std::move(z);
+                    newton_to_evaluation = std::move(to_evaluation);
+                    newton_to_evaluation_inverse = std::move(to_evaluation_inverse);
+                    basis_change_z_reversed_fft = std::move(z_reversed_fft);
+                    basis_change_u_reversed_fft = std::move(u_reversed_fft);
+                    newton_to_evaluation_fft = std::move(to_evaluation_fft);
+                    interpolation_to_newton_fft = std::move(to_newton_fft);
+                    lagrange_weights = std::move(weights);
+
+                    precomputation_sentinel.store(true, std::memory_order_release);
+                }
+
+                /**
+                 * Store the precomputed state to path, computing it first if needed.
+                 */
+                void save_precomputation(const std::string &path) {
+                    precompute();
+
+                    std::vector<detail::precomputed_table<value_type>> tables;
+                    for (const detail::precomputed_table<value_type> *table : precomputation_tables()) {
+                        tables.push_back(*table);
+                    }
+
+                    detail::write_precomputation(path, precomputation_kind, this->m, precomputation_fingerprint(),
+                                                 tables);
+                }
+
+                /**
+                 * Adopt the precomputed state stored in path by save_precomputation. The tables are decoded
+                 * from the file, nothing is recomputed.
+                 * The domain must not be precomputed yet, since other threads may already read its tables
+                 * without the lock; every table is validated before any of them is adopted.
+                 */
+                void load_precomputation(const std::string &path) {
+                    std::lock_guard<std::mutex> lock(precomputation_mutex);
+
+                    if (precomputation_sentinel.load(std::memory_order_relaxed)) {
+                        throw std::invalid_argument("geometric: domain is already precomputed");
+                    }
+
+                    const detail::precomputation_file file(path);
+                    if (file.kind() != precomputation_kind || file.size() != this->m ||
+                        file.fingerprint() != precomputation_fingerprint()) {
+                        throw std::invalid_argument("geometric: precomputation does not match the domain");
+                    }
+
+                    const std::vector<detail::precomputed_table<value_type> *> tables = precomputation_tables();
+                    if (file.tables() != tables.size()) {
+                        throw std::invalid_argument("geometric: unexpected number of precomputed tables");
+                    }
+
+                    /* The FFT images hold transform_size values, the others m */
+                    const std::size_t transform = detail::power_of_two(2 * this->m - 1);
+                    const std::vector<const detail::precomputed_table<value_type> *> images = {
+                        &basis_change_z_reversed_fft, &basis_change_u_reversed_fft, &newton_to_evaluation_fft,
+                        &interpolation_to_newton_fft};
+
+                    std::vector<detail::precomputed_table<value_type>> loaded(tables.size());
+                    for (std::size_t i = 0; i < tables.size(); i++) {
+                        loaded[i] = file.table<value_type>(i);
+
+                        const bool image = std::find(images.begin(), images.end(), tables[i]) != images.end();
+                        if (loaded[i].size() != (image ? transform : this->m)) {
+                            throw std::invalid_argument("geometric: precomputed table has unexpected size");
+                        }
+                    }
+
+                    transform_size = transform;
+                    for (std::size_t i = 0; i < tables.size(); i++) {
+                        *tables[i] = std::move(loaded[i]);
+                    }
+
+                    precomputation_sentinel.store(true, std::memory_order_release);
                 }
 
                 geometric_sequence_domain(const std::size_t m) : evaluation_domain<FieldType>(m) {
@@ -85,7 +296,37 @@ namespace nil {
                             "true");
                     }
 
-                    precomputation_sentinel = false;
+                    precomputation_sentinel.store(false, std::memory_order_relaxed);
+                    vanishing_sentinel.store(false, std::memory_order_relaxed);
+                }
+
+                /**
+                 * Compute the tables now instead of on first use. Safe to call concurrently: the tables are
+                 * computed exactly once, after which the domain is immutable and may be shared by all threads.
+                 */
+                void precompute() {
+                    if (!precomputation_sentinel.load(std::memory_order_acquire)) {
+                        std::lock_guard<std::mutex> lock(precomputation_mutex);
+                        if (!precomputation_sentinel.load(std::memory_order_relaxed)) {
+                            do_precomputation();
+                        }
+                    }
+                }
+
+                /**
+                 * Compute the vanishing polynomial coefficients now instead of on first use, with the same
+                 * guarantees as precompute.
+                 */
+                void precompute_vanishing() {
+                    if (!vanishing_sentinel.load(std::memory_order_acquire)) {
+                        precompute();
+
+                        std::lock_guard<std::mutex> lock(precomputation_mutex);
+                        if (!vanishing_sentinel.load(std::memory_order_relaxed)) {
+                            vanishing_coefficients = compute_vanishing_coefficients();
+                            vanishing_sentinel.store(true, std::memory_order_release);
+                        }
+                    }
                 }
 
                 void fft(std::vector<value_type> &a) {
@@ -97,32 +338,36 @@ namespace nil {
                         }
                     }
 
-                    if (!precomputation_sentinel)
-                        do_precomputation();
-
-                    monomial_to_newton_basis_geometric<FieldType>(a, geometric_sequence, geometric_triangular_sequence,
-                                                                  this->m);
+                    precompute();
 
-                    /* Newton to Evaluation */
-                    std::vector<value_type> T(this->m);
-                    T[0] = value_type::one();
+                    /* Monomial to Newton: see monomial_to_newton_basis_geometric */
+                    detail::scratch_vector<value_type> w(this->m);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t i = 0; i < this->m; i++) {
+                        w[i] = a[i] * monomial_to_newton_scale[i];
+                    }
 
-                    std::vector<value_type> g(this->m);
-                    g[0] = a[0];
+                    transformed_multiplication(w, w, basis_change_z_reversed_fft);
+                    w.resize(transform_size, value_type::zero());
 
-                    for (std::size_t i = 1; i < this->m; i++) {
-                        T[i] = T[i - 1] * (geometric_sequence[i] - value_type::one()).inversed();
-                        g[i] = geometric_triangular_sequence[i] * a[i];
+                    /* Newton to Evaluation: the Newton coefficients w_i * z_i are scaled by the triangular sequence */
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t i = 0; i < this->m; i++) {
+                        a[i] = w[this->m - 1 + i] * newton_to_evaluation_scale[i];
                     }
 
-                    multiplication(a, g, T);
+                    transformed_multiplication(a, a, newton_to_evaluation_fft);
                     a.resize(this->m);
 
 #ifdef MULTICORE
 #pragma omp parallel for
 #endif
                     for (std::size_t i = 0; i < this->m; i++) {
-                        a[i] *= T[i].inversed();
+                        a[i] *= newton_to_evaluation_inverse[i];
                     }
                 }
                 void inverse_fft(std::vector<value_type> &a) {
@@ -134,38 +379,39 @@ namespace nil {
                         }
                     }
 
-                    if (!precomputation_sentinel)
-                        do_precomputation();
+                    precompute();
 
                     /* Interpolation to Newton */
-                    std::vector<value_type> T(this->m);
-                    T[0] = value_type::one();
-
-                    std::vector<value_type> W(this->m);
-                    W[0] = a[0] * T[0];
-
-                    value_type prev_T = T[0];
-                    for (std::size_t i = 1; i < this->m; i++) {
-                        prev_T *= (geometric_sequence[i] - value_type::one()).inversed();
-
-                        W[i] = a[i] * prev_T;
-                        T[i] = geometric_triangular_sequence[i] * prev_T;
-                        if (i % 2 == 1)
-                            T[i] = -T[i];
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t i = 0; i < this->m; i++) {
+                        a[i] *= newton_to_evaluation[i];
                     }
 
-                    multiplication(a, W, T);
-                    a.resize(this->m);
+                    transformed_multiplication(a, a, interpolation_to_newton_fft);
+                    a.resize(this->m, value_type::zero());
 
+                    /* Newton to Monomial: see newton_to_monomial_basis_geometric */
 #ifdef MULTICORE
 #pragma omp parallel for
 #endif
                     for (std::size_t i = 0; i < this->m; i++) {
-                        a[i] *= geometric_triangular_sequence[i].inversed();
+                        a[i] *= newton_to_monomial_scale[i];
                     }
 
-                    newton_to_monomial_basis_geometric<FieldType>(a, geometric_sequence, geometric_triangular_sequence,
-                                                                  this->m);
+                    transformed_multiplication(a, a, basis_change_u_reversed_fft);
+                    a.resize(transform_size, value_type::zero());
+
+                    /* a[m - 1] is both read for i = 0 and written for i = m - 1, so it is moved first */
+                    a[0] = a[this->m - 1] * basis_change_z[0];
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t i = 1; i < this->m; i++) {
+                        a[i] = a[this->m - 1 + i] * basis_change_z[i];
+                    }
+                    a.resize(this->m);
                 }
                 std::vector<value_type> evaluate_all_lagrange_polynomials(const value_type &t) {
                     /* Compute Lagrange polynomial of size m, with m+1 points (x_0, y_0), ... ,(x_m, y_m) */
@@ -174,9 +420,7 @@ namespace nil {
 
                     /* for all i: w[i] = (1 / r) * w[i-1] * (1 - a[i]^m-i+1) / (1 - a[i]^-i) */
 
-                    if (!precomputation_sentinel) {
-                        do_precomputation();
-                    }
+                    precompute();
 
                     /**
                      * If t equals one of the geometric progression values,
@@ -198,43 +442,25 @@ namespace nil {
                     std::vector<value_type> l(this->m);
                     l[0] = t - geometric_sequence[0];
 
-                    std::vector<value_type> g(this->m);
-                    g[0] = value_type::zero();
-
                     value_type l_vanish = l[0];
-                    value_type g_vanish = value_type::one();
                     for (std::size_t i = 1; i < this->m; i++) {
                         l[i] = t - geometric_sequence[i];
-                        g[i] = value_type::one() - geometric_sequence[i];
-
                         l_vanish *= l[i];
-                        g_vanish *= g[i];
                     }
 
-                    value_type r = geometric_sequence[this->m - 1].inversed();
-                    value_type r_i = r;
-
-                    std::vector<value_type> g_i(this->m);
-                    g_i[0] = g_vanish.inversed();
-
-                    l[0] = l_vanish * l[0].inversed() * g_i[0];
-                    for (std::size_t i = 1; i < this->m; i++) {
-                        g_i[i] = g_i[i - 1] * g[this->m - i] * -g[i].inversed() * geometric_sequence[i];
-                        l[i] = l_vanish * r_i * l[i].inversed() * g_i[i];
-                        r_i *= r;
+                    for (std::size_t i = 0; i < this->m; i++) {
+                        l[i] = l_vanish * l[i].inversed() * lagrange_weights[i];
                     }
 
                     return l;
                 }
                 value_type get_domain_element(const std::size_t idx) {
-                    if (!precomputation_sentinel)
-                        do_precomputation();
+                    precompute();
 
                     return this->geometric_sequence[idx];
                 }
                 value_type compute_vanishing_polynomial(const value_type &t) {
-                    if (!precomputation_sentinel)
-                        do_precomputation();
+                    precompute();
 
                     /* Notes: Z = prod_{i = 0 to m} (t - a[i]) */
                     /* Better approach: Montgomery Trick + Divide&Conquer/FFT */
@@ -248,28 +474,25 @@ namespace nil {
                     if (H.size() != this->m + 1)
                         throw std::invalid_argument("geometric: expected H.size() == this->m+1");
 
-                    if (!precomputation_sentinel)
-                        do_precomputation();
-
-                    std::vector<value_type> x(2, value_type::zero());
-                    x[0] = -geometric_sequence[0];
-                    x[1] = value_type::one();
-
-                    std::vector<value_type> t(2, value_type::zero());
-
-                    for (std::size_t i = 1; i < this->m + 1; i++) {
-                        t[0] = -geometric_sequence[i];
-                        t[1] = value_type::one();
-
-                        multiplication(x, x, t);
-                    }
+                    precompute_vanishing();
 
 #ifdef MULTICORE
 #pragma omp parallel for
 #endif
                     for (std::size_t i = 0; i < this->m + 1; i++) {
-                        H[i] += (x[i] * coeff);
+                        H[i] += (vanishing_coefficients[i] * coeff);
+                    }
+                }
+                std::vector<std::pair<std::size_t, value_type>> get_vanishing_polynomial_terms() {
+                    precompute_vanishing();
+
+                    std::vector<std::pair<std::size_t, value_type>> terms;
+                    for (std::size_t i = 0; i < this->m + 1; i++) {
+                        if (!vanishing_coefficients[i].is_zero()) {
+                            terms.emplace_back(i, vanishing_coefficients[i]);
+                        }
                     }
+                    return terms;
                 }
                 void divide_by_z_on_coset(std::vector<value_type> &P) {
                     const value_type coset = value_type(
@@ -280,6 +503,67 @@ namespace nil {
                         P[i] *= Z_inverse_at_coset;
                     }
                 }
+
+            private:
+                /*
+                 * prod_{i < m} (x - a_i) by doubling over the binary digits of m. With P_k the product over the
+                 * first k points, the product over the next k is a_k^k * P_k(x / a_k), whose coefficient j is
+                 * the one of P_k times a_k^{k - j}. One product per digit, so O(M(m)) in total.
+                 */
+                std::vector<value_type> compute_vanishing_coefficients() const {
+                    std::size_t digit = 0;
+                    while ((this->m >> digit) > 1) {
+                        ++digit;
+                    }
+
+                    std::vector<value_type> vanishing = {-value_type::one(), value_type::one()};
+                    std::size_t points = 1;
+                    while (digit-- > 0) {
+                        std::vector<value_type> upper(points + 1);
+                        value_type scale = value_type::one();
+                        for (std::size_t j = points + 1; j-- > 0;) {
+                            upper[j] = vanishing[j] * scale;
+                            scale *= geometric_sequence[points];
+                        }
+                        multiplication(vanishing, vanishing, upper);
+                        points *= 2;
+
+                        if ((this->m >> digit) & 1) {
+                            const value_type a = geometric_sequence[points];
+                            vanishing.push_back(value_type::zero());
+                            for (std::size_t j = points + 1; j > 0; j--) {
+                                vanishing[j] = vanishing[j - 1] - a * vanishing[j];
+                            }
+                            vanishing[0] = -a * vanishing[0];
+                            points++;
+                        }
+                    }
+                    return vanishing;
+                }
+
+                std::uint64_t precomputation_fingerprint() const {
+                    return detail::precomputation_fingerprint<value_type>(
+                        {value_type::one(), -value_type::one(),
+                         value_type(fields::arithmetic_params<FieldType>::geometric_generator)});
+                }
+
+                /* The order of the tables in precomputation files */
+                std::vector<detail::precomputed_table<value_type> *> precomputation_tables() {
+                    return {&geometric_sequence,
+                            &geometric_triangular_sequence,
+                            &geometric_triangular_sequence_inverse,
+                            &monomial_to_newton_scale,
+                            &newton_to_monomial_scale,
+                            &newton_to_evaluation_scale,
+                            &basis_change_z,
+                            &newton_to_evaluation,
+                            &newton_to_evaluation_inverse,
+                            &basis_change_z_reversed_fft,
+                            &basis_change_u_reversed_fft,
+                            &newton_to_evaluation_fft,
+                            &interpolation_to_newton_fft,
+                            &lagrange_weights};
+                }
             };
         }    // namespace math
     }        // namespace crypto3
@@ -32,6 +32,10 @@
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 namespace nil {
     namespace crypto3 {
         namespace math {
@@ -54,6 +58,15 @@ namespace nil {
                 value_type big_omega;
                 value_type small_omega;
 
+                /* Per-call constants of fft and inverse_fft */
+                value_type big_omega_inverse;
+                value_type small_omega_inverse;
+                value_type big_m_inverse;
+                value_type small_m_inverse;
+                /* omega^i for i < big_m and omega^-i for i < small_m */
+                std::vector<value_type> omega_powers;
+                std::vector<value_type> omega_inverse_powers;
+
                 step_radix2_domain(const std::size_t m) : evaluation_domain<FieldType>(m) {
                     if (m <= 1)
                         throw std::invalid_argument("step_radix2(): expected m > 1");
@@ -68,6 +81,24 @@ namespace nil {
 
                     big_omega = omega.squared();
                     small_omega = unity_root<FieldType>(small_m);
+
+                    big_omega_inverse = big_omega.inversed();
+                    small_omega_inverse = small_omega.inversed();
+                    big_m_inverse = value_type(big_m).inversed();
+                    small_m_inverse = value_type(small_m).inversed();
+
+                    omega_powers.resize(big_m);
+                    omega_powers[0] = value_type::one();
+                    for (std::size_t i = 1; i < big_m; ++i) {
+                        omega_powers[i] = omega_powers[i - 1] * omega;
+                    }
+
+                    const value_type omega_inverse = omega.inversed();
+                    omega_inverse_powers.resize(small_m);
+                    omega_inverse_powers[0] = value_type::one();
+                    for (std::size_t i = 1; i < small_m; ++i) {
+                        omega_inverse_powers[i] = omega_inverse_powers[i - 1] * omega_inverse;
+                    }
                 }
 
                 void fft(std::vector<value_type> &a) {
@@ -79,32 +110,42 @@ namespace nil {
                         }
                     }
 
-                    std::vector<value_type> c(big_m, value_type::zero());
-                    std::vector<value_type> d(big_m, value_type::zero());
+                    detail::scratch_vector<value_type> c(big_m, value_type::zero());
+                    detail::scratch_vector<value_type> e(small_m, value_type::zero());
 
-                    value_type omega_i = value_type::one();
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = 0; i < big_m; ++i) {
                         c[i] = (i < small_m ? a[i] + a[i + big_m] : a[i]);
-                        d[i] = omega_i * (i < small_m ? a[i] - a[i + big_m] : a[i]);
-                        omega_i *= omega;
                     }
 
-                    std::vector<value_type> e(small_m, value_type::zero());
-                    const std::size_t compr = 1ul << (static_cast<std::size_t>(std::ceil(std::log2(big_m))) -
-                                                      static_cast<std::size_t>(std::ceil(std::log2(small_m))));
+                    /* e_i = sum_j d_{i + j * small_m} with d_i = omega^i * (a_i - a_{i + big_m}) */
+                    const std::size_t compr = big_m / small_m;
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        for (std::size_t j = 0; j < compr; ++j) {
-                            e[i] += d[i + j * small_m];
+                        value_type sum = omega_powers[i] * (a[i] - a[i + big_m]);
+                        for (std::size_t j = 1; j < compr; ++j) {
+                            sum += omega_powers[i + j * small_m] * a[i + j * small_m];
                         }
+                        e[i] = sum;
                     }
 
-                    _basic_radix2_fft<FieldType>(c, omega.squared());
-                    _basic_radix2_fft<FieldType>(e, unity_root<FieldType>(small_m));
+                    transform_halves(c, big_omega, e, small_omega);
 
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = 0; i < big_m; ++i) {
                         a[i] = c[i];
                     }
 
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = 0; i < small_m; ++i) {
                         a[i + big_m] = e[i];
                     }
@@ -113,58 +154,42 @@ namespace nil {
                     if (a.size() != this->m)
                         throw std::invalid_argument("step_radix2: expected a.size() == this->m");
 
-                    std::vector<value_type> U0(a.begin(), a.begin() + big_m);
-                    std::vector<value_type> U1(a.begin() + big_m, a.end());
+                    detail::scratch_vector<value_type> U0(a.begin(), a.begin() + big_m);
+                    detail::scratch_vector<value_type> U1(a.begin() + big_m, a.end());
 
-                    _basic_radix2_fft<FieldType>(U0, omega.squared().inversed());
-                    _basic_radix2_fft<FieldType>(U1, unity_root<FieldType>(small_m).inversed());
+                    transform_halves(U0, big_omega_inverse, U1, small_omega_inverse);
 
-                    const value_type U0_size_inv = value_type(big_m).inversed();
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = 0; i < big_m; ++i) {
-                        U0[i] *= U0_size_inv;
-                    }
-
-                    const value_type U1_size_inv = value_type(small_m).inversed();
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        U1[i] *= U1_size_inv;
-                    }
-
-                    std::vector<value_type> tmp = U0;
-                    value_type omega_i = value_type::one();
-                    for (std::size_t i = 0; i < big_m; ++i) {
-                        tmp[i] *= omega_i;
-                        omega_i *= omega;
+                        U0[i] *= big_m_inverse;
                     }
 
                     // save A_suffix
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = small_m; i < big_m; ++i) {
                         a[i] = U0[i];
                     }
 
-                    const std::size_t compr = 1ul << (static_cast<std::size_t>(std::ceil(std::log2(big_m))) -
-                                                      static_cast<std::size_t>(std::ceil(std::log2(small_m))));
+                    const std::size_t compr = big_m / small_m;
+                    const value_type over_two = value_type(2).inversed();
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = 0; i < small_m; ++i) {
+                        value_type u1 = U1[i] * small_m_inverse;
                         for (std::size_t j = 1; j < compr; ++j) {
-                            U1[i] -= tmp[i + j * small_m];
+                            u1 -= U0[i + j * small_m] * omega_powers[i + j * small_m];
                         }
-                    }
+                        u1 *= omega_inverse_powers[i];
 
-                    const value_type omega_inv = omega.inversed();
-                    value_type omega_inv_i = value_type::one();
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        U1[i] *= omega_inv_i;
-                        omega_inv_i *= omega_inv;
-                    }
-
-                    // compute A_prefix
-                    const value_type over_two = value_type(2).inversed();
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        a[i] = (U0[i] + U1[i]) * over_two;
-                    }
-
-                    // compute B2
-                    for (std::size_t i = 0; i < small_m; ++i) {
-                        a[big_m + i] = (U0[i] - U1[i]) * over_two;
+                        // compute A_prefix and B2
+                        a[i] = (U0[i] + u1) * over_two;
+                        a[big_m + i] = (U0[i] - u1) * over_two;
                     }
                 }
 
@@ -219,6 +244,23 @@ namespace nil {
                     H[small_m] -= coeff;
                     H[0] += coeff * omega_to_small_m;
                 }
+                std::vector<std::pair<std::size_t, value_type>> get_vanishing_polynomial_terms() {
+                    const value_type omega_to_small_m = omega.pow(small_m);
+
+                    std::vector<std::pair<std::size_t, value_type>> terms = {{0, omega_to_small_m},
+                                                                             {small_m, -value_type::one()},
+                                                                             {big_m, -omega_to_small_m},
+                                                                             {this->m, value_type::one()}};
+                    /* For m a power of two the middle terms meet, and cancel since omega^small_m = -1 */
+                    if (small_m == big_m) {
+                        terms[1].second += terms[2].second;
+                        terms.erase(terms.begin() + 2);
+                        if (terms[1].second.is_zero()) {
+                            terms.erase(terms.begin() + 1);
+                        }
+                    }
+                    return terms;
+                }
                 void divide_by_z_on_coset(std::vector<value_type> &P) {
                     // (c^{2^k}-1) * (c^{2^r} * w^{2^{r+1}*i) - w^{2^r})
                     const value_type coset = fields::arithmetic_params<FieldType>::multiplicative_generator;
@@ -244,6 +286,30 @@ namespace nil {
                         P[big_m + i] *= Z1_inverse;
                     }
                 }
+
+            private:
+                /*
+                 * The big_m and small_m sized transforms are independent, so under MULTICORE they are spawned as
+                 * tasks of one parallel region and share its threads instead of running one after the other.
+                 */
+                static void transform_halves(detail::scratch_vector<value_type> &big,
+                                             const value_type &big_root,
+                                             detail::scratch_vector<value_type> &small,
+                                             const value_type &small_root) {
+#ifdef MULTICORE
+#pragma omp parallel
+#pragma omp single
+                    {
+#pragma omp task
+                        detail::basic_task_radix2_fft<FieldType>(big, big_root);
+#pragma omp task
+                        detail::basic_task_radix2_fft<FieldType>(small, small_root);
+                    }
+#else
+                    detail::basic_serial_radix2_fft<FieldType>(big, big_root);
+                    detail::basic_serial_radix2_fft<FieldType>(small, small_root);
+#endif
+                }
             };
         }    // namespace math
     }        // namespace crypto3
@@ -27,10 +27,19 @@
 #define CRYPTO3_MATH_POLYNOMIAL_BASIC_OPERATIONS_HPP
 
 #include <algorithm>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/detail/arena.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
 
 namespace nil {
@@ -80,25 +89,18 @@ namespace nil {
                 typedef
                     typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
 
-                if (is_zero(a)) {
-                    c = b;
-                } else if (is_zero(b)) {
-                    c = a;
+                /* A zero operand needs no special case, the result is condensed anyway */
+                const std::size_t a_size = std::distance(std::begin(a), std::end(a));
+                const std::size_t b_size = std::distance(std::begin(b), std::end(b));
+
+                if (a_size > b_size) {
+                    c.resize(a_size);
+                    std::transform(std::begin(b), std::end(b), std::begin(a), std::begin(c), std::plus<value_type>());
+                    std::copy(std::begin(a) + b_size, std::end(a), std::begin(c) + b_size);
                 } else {
-                    std::size_t a_size = std::distance(std::begin(a), std::end(a));
-                    std::size_t b_size = std::distance(std::begin(b), std::end(b));
-
-                    if (a_size > b_size) {
-                        c.resize(a_size);
-                        std::transform(
-                            std::begin(b), std::end(b), std::begin(a), std::begin(c), std::plus<value_type>());
-                        std::copy(std::begin(a) + b_size, std::end(a), std::begin(c) + b_size);
-                    } else {
-                        c.resize(b_size);
-                        std::transform(
-                            std::begin(a), std::end(a), std::begin(b), std::begin(c), std::plus<value_type>());
-                        std::copy(std::begin(b) + a_size, std::end(b), std::begin(c) + a_size);
-                    }
+                    c.resize(b_size);
+                    std::transform(std::begin(a), std::end(a), std::begin(b), std::begin(c), std::plus<value_type>());
+                    std::copy(std::begin(b) + a_size, std::end(b), std::begin(c) + a_size);
                 }
 
                 condense(c);
@@ -114,28 +116,279 @@ namespace nil {
                 typedef
                     typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
 
-                if (is_zero(b)) {
-                    c = a;
-                } else if (is_zero(a)) {
-                    c.resize(b.size());
-                    std::transform(b.begin(), b.end(), c.begin(), std::negate<value_type>());
+                const std::size_t a_size = a.size();
+                const std::size_t b_size = b.size();
+
+                if (a_size > b_size) {
+                    c.resize(a_size);
+                    std::transform(a.begin(), a.begin() + b_size, b.begin(), c.begin(), std::minus<value_type>());
+                    std::copy(a.begin() + b_size, a.end(), c.begin() + b_size);
                 } else {
-                    std::size_t a_size = a.size();
-                    std::size_t b_size = b.size();
+                    c.resize(b_size);
+                    std::transform(a.begin(), a.end(), b.begin(), c.begin(), std::minus<value_type>());
+                    std::transform(b.begin() + a_size, b.end(), c.begin() + a_size, std::negate<value_type>());
+                }
+
+                condense(c);
+            }
+
+            namespace detail {
+                /*
+                 * Size of the shorter factor from which multiply_add moves on to the next algorithm: schoolbook
+                 * below karatsuba_threshold, Karatsuba below toom3_threshold, Toom-3 below
+                 * fft_multiplication_threshold and radix-2 FFTs from there on.
+                 */
+                constexpr std::size_t karatsuba_threshold = 16;
+                constexpr std::size_t toom3_threshold = 64;
+                constexpr std::size_t fft_multiplication_threshold = 128;
+
+                template<typename ValueType>
+                void multiply_add(ValueType *out,
+                                  const ValueType *a,
+                                  std::size_t a_size,
+                                  const ValueType *b,
+                                  std::size_t b_size);
+
+                /*
+                 * Add src to out[offset, out_size). Coefficients falling beyond out_size are known to vanish.
+                 */
+                template<typename ValueType>
+                void add_shifted(ValueType *out,
+                                 std::size_t out_size,
+                                 std::size_t offset,
+                                 const scratch_vector<ValueType> &src) {
+                    const std::size_t count = std::min(src.size(), out_size - std::min(out_size, offset));
+                    for (std::size_t i = 0; i < count; i++) {
+                        out[offset + i] += src[i];
+                    }
+                }
+
+                template<typename ValueType>
+                void schoolbook_multiply_add(ValueType *out,
+                                             const ValueType *a,
+                                             std::size_t a_size,
+                                             const ValueType *b,
+                                             std::size_t b_size) {
+                    if (a == b && a_size == b_size) {
+                        /* Squaring: the cross products a_k * a_t with k < t appear twice */
+                        for (std::size_t k = 0; k < a_size; k++) {
+                            const ValueType twice = a[k] + a[k];
+                            out[2 * k] += a[k] * a[k];
+                            for (std::size_t t = k + 1; t < a_size; t++) {
+                                out[k + t] += twice * a[t];
+                            }
+                        }
+                        return;
+                    }
+
+                    for (std::size_t k = 0; k < a_size; k++) {
+                        for (std::size_t t = 0; t < b_size; t++) {
+                            out[k + t] += a[k] * b[t];
+                        }
+                    }
+                }
+
+                /*
+                 * Expects a_size >= b_size > (a_size + 1) / 2. With a = a_0 + x^h a_1 and b = b_0 + x^h b_1 the
+                 * middle part a_0 b_1 + a_1 b_0 is (a_0 + a_1)(b_0 + b_1) - a_0 b_0 - a_1 b_1.
+                 */
+                template<typename ValueType>
+                void karatsuba_multiply_add(ValueType *out,
+                                            const ValueType *a,
+                                            std::size_t a_size,
+                                            const ValueType *b,
+                                            std::size_t b_size) {
+                    const bool square = a == b && a_size == b_size;
+                    const std::size_t h = (a_size + 1) / 2;
+                    const std::size_t out_size = a_size + b_size - 1;
+
+                    scratch_vector<ValueType> z0(2 * h - 1, ValueType::zero());
+                    multiply_add(z0.data(), a, h, b, h);
+
+                    scratch_vector<ValueType> z2(a_size + b_size - 2 * h - 1, ValueType::zero());
+                    multiply_add(z2.data(), a + h, a_size - h, b + h, b_size - h);
+
+                    scratch_vector<ValueType> sa(a, a + h);
+                    for (std::size_t i = h; i < a_size; i++) {
+                        sa[i - h] += a[i];
+                    }
+                    scratch_vector<ValueType> sb;
+                    if (!square) {
+                        sb.assign(b, b + h);
+                        for (std::size_t i = h; i < b_size; i++) {
+                            sb[i - h] += b[i];
+                        }
+                    }
 
-                    if (a_size > b_size) {
-                        c.resize(a_size);
-                        std::transform(a.begin(), a.begin() + b_size, b.begin(), c.begin(), std::minus<value_type>());
-                        std::copy(a.begin() + b_size, a.end(), c.begin() + b_size);
+                    scratch_vector<ValueType> z1(2 * h - 1, ValueType::zero());
+                    multiply_add(z1.data(), sa.data(), h, square ? sa.data() : sb.data(), h);
+                    for (std::size_t i = 0; i < z0.size(); i++) {
+                        z1[i] -= z0[i];
+                    }
+                    for (std::size_t i = 0; i < z2.size(); i++) {
+                        z1[i] -= z2[i];
+                    }
+
+                    add_shifted(out, out_size, 0, z0);
+                    add_shifted(out, out_size, h, z1);
+                    add_shifted(out, out_size, 2 * h, z2);
+                }
+
+                /*
+                 * Toom-3 with the evaluation points 0, 1, -1, -2, infinity and Bodrato's interpolation sequence.
+                 * Expects a_size >= b_size > 2k with k = ceil(a_size / 3), and a field of characteristic > 3.
+                 */
+                template<typename ValueType>
+                void toom3_multiply_add(ValueType *out,
+                                        const ValueType *a,
+                                        std::size_t a_size,
+                                        const ValueType *b,
+                                        std::size_t b_size) {
+                    const bool square = a == b && a_size == b_size;
+                    const std::size_t k = (a_size + 2) / 3;
+                    const std::size_t out_size = a_size + b_size - 1;
+
+                    /* Values of the three parts of p at 1, -1 and -2 */
+                    auto evaluate = [k](const ValueType *p, std::size_t p_size, scratch_vector<ValueType> &at_one,
+                                        scratch_vector<ValueType> &at_minus_one,
+                                        scratch_vector<ValueType> &at_minus_two) {
+                        at_one.assign(k, ValueType::zero());
+                        at_minus_one.assign(k, ValueType::zero());
+                        at_minus_two.assign(k, ValueType::zero());
+                        for (std::size_t i = 0; i < k; i++) {
+                            const ValueType p2 = 2 * k + i < p_size ? p[2 * k + i] : ValueType::zero();
+                            const ValueType even = p[i] + p2;
+                            at_one[i] = even + p[k + i];
+                            at_minus_one[i] = even - p[k + i];
+                            at_minus_two[i] = p[i] - (p[k + i] + p[k + i]) + (p2 + p2 + p2 + p2);
+                        }
+                    };
+
+                    scratch_vector<ValueType> a_one, a_minus_one, a_minus_two;
+                    evaluate(a, a_size, a_one, a_minus_one, a_minus_two);
+                    scratch_vector<ValueType> b_one, b_minus_one, b_minus_two;
+                    if (!square) {
+                        evaluate(b, b_size, b_one, b_minus_one, b_minus_two);
+                    }
+
+                    auto product = [square](const ValueType *p, std::size_t p_size, const ValueType *q,
+                                            std::size_t q_size) {
+                        scratch_vector<ValueType> r(p_size + q_size - 1, ValueType::zero());
+                        multiply_add(r.data(), p, p_size, square ? p : q, q_size);
+                        return r;
+                    };
+
+                    scratch_vector<ValueType> r0 = product(a, k, b, k);
+                    scratch_vector<ValueType> r1 = product(a_one.data(), k, b_one.data(), k);
+                    scratch_vector<ValueType> r2 = product(a_minus_one.data(), k, b_minus_one.data(), k);
+                    scratch_vector<ValueType> r3 = product(a_minus_two.data(), k, b_minus_two.data(), k);
+                    scratch_vector<ValueType> r4 = product(a + 2 * k, a_size - 2 * k, b + 2 * k, b_size - 2 * k);
+                    r4.resize(2 * k - 1, ValueType::zero());
+
+                    const ValueType half = ValueType(2).inversed();
+                    const ValueType third = ValueType(3).inversed();
+                    for (std::size_t i = 0; i < 2 * k - 1; i++) {
+                        const ValueType at_minus_one = r2[i];
+                        r3[i] = (r3[i] - r1[i]) * third;
+                        r1[i] = (r1[i] - at_minus_one) * half;
+                        r2[i] = at_minus_one - r0[i];
+                        r3[i] = (r2[i] - r3[i]) * half + r4[i] + r4[i];
+                        r2[i] = r2[i] + r1[i] - r4[i];
+                        r1[i] = r1[i] - r3[i];
+                    }
+
+                    add_shifted(out, out_size, 0, r0);
+                    add_shifted(out, out_size, k, r1);
+                    add_shifted(out, out_size, 2 * k, r2);
+                    add_shifted(out, out_size, 3 * k, r3);
+                    add_shifted(out, out_size, 4 * k, r4);
+                }
+
+                template<typename ValueType>
+                void fft_multiply_add(ValueType *out,
+                                      const ValueType *a,
+                                      std::size_t a_size,
+                                      const ValueType *b,
+                                      std::size_t b_size) {
+                    typedef typename ValueType::field_type FieldType;
+
+                    const bool square = a == b && a_size == b_size;
+                    const std::size_t out_size = a_size + b_size - 1;
+                    const std::size_t n = power_of_two(out_size);
+                    const ValueType omega = unity_root<FieldType>(n);
+
+                    scratch_vector<ValueType> u(n, ValueType::zero());
+                    std::copy(a, a + a_size, u.begin());
+#ifdef MULTICORE
+                    basic_parallel_radix2_fft<FieldType>(u, omega);
+#else
+                    basic_serial_radix2_fft<FieldType>(u, omega);
+#endif
+
+                    if (square) {
+                        for (std::size_t i = 0; i < n; i++) {
+                            u[i] *= u[i];
+                        }
                     } else {
-                        c.resize(b_size);
-                        std::transform(a.begin(), a.end(), b.begin(), c.begin(), std::minus<value_type>());
-                        std::transform(b.begin() + a_size, b.end(), c.begin() + a_size, std::negate<value_type>());
+                        scratch_vector<ValueType> v(n, ValueType::zero());
+                        std::copy(b, b + b_size, v.begin());
+#ifdef MULTICORE
+                        basic_parallel_radix2_fft<FieldType>(v, omega);
+#else
+                        basic_serial_radix2_fft<FieldType>(v, omega);
+#endif
+                        for (std::size_t i = 0; i < n; i++) {
+                            u[i] *= v[i];
+                        }
+                    }
+
+#ifdef MULTICORE
+                    basic_parallel_radix2_fft<FieldType>(u, omega.inversed());
+#else
+                    basic_serial_radix2_fft<FieldType>(u, omega.inversed());
+#endif
+
+                    const ValueType sconst = ValueType(n).inversed();
+                    for (std::size_t i = 0; i < out_size; i++) {
+                        out[i] += u[i] * sconst;
                     }
                 }
 
-                condense(c);
-            }
+                /*
+                 * Add the product of a and b to out, which has room for a_size + b_size - 1 coefficients and
+                 * must not overlap the factors. The algorithm is chosen by the size of the shorter factor;
+                 * unbalanced products are cut into balanced ones. Passing the same pointer and size for both
+                 * factors selects the cheaper squaring variants.
+                 */
+                template<typename ValueType>
+                void multiply_add(ValueType *out,
+                                  const ValueType *a,
+                                  std::size_t a_size,
+                                  const ValueType *b,
+                                  std::size_t b_size) {
+                    if (a_size < b_size) {
+                        std::swap(a, b);
+                        std::swap(a_size, b_size);
+                    }
+
+                    if (b_size == 0) {
+                        return;
+                    }
+                    if (b_size < karatsuba_threshold) {
+                        schoolbook_multiply_add(out, a, a_size, b, b_size);
+                    } else if (b_size >= fft_multiplication_threshold) {
+                        fft_multiply_add(out, a, a_size, b, b_size);
+                    } else if (b_size <= (a_size + 1) / 2) {
+                        for (std::size_t offset = 0; offset < a_size; offset += b_size) {
+                            multiply_add(out + offset, a + offset, std::min(b_size, a_size - offset), b, b_size);
+                        }
+                    } else if (b_size >= toom3_threshold && b_size > 2 * ((a_size + 2) / 3)) {
+                        toom3_multiply_add(out, a, a_size, b, b_size);
+                    } else {
+                        karatsuba_multiply_add(out, a, a_size, b, b_size);
+                    }
+                }
+            }    // namespace detail
 
             /**
              * Perform the multiplication of two polynomials, polynomial A * polynomial B, using FFT, and stores
@@ -154,43 +407,155 @@ namespace nil {
                 const std::size_t n = detail::power_of_two(a.size() + b.size() - 1);
                 value_type omega = unity_root<FieldType>(n);
 
-                Range u(a);
-                Range v(b);
-                u.resize(n, value_type::zero());
-                v.resize(n, value_type::zero());
-                c.resize(n, value_type::zero());
-
+                Range u(n, value_type::zero());
+                std::copy(a.begin(), a.end(), u.begin());
 #ifdef MULTICORE
                 detail::basic_parallel_radix2_fft<FieldType>(u, omega);
-                detail::basic_parallel_radix2_fft<FieldType>(v, omega);
 #else
                 detail::basic_serial_radix2_fft<FieldType>(u, omega);
-                detail::basic_serial_radix2_fft<FieldType>(v, omega);
 #endif
 
-                std::transform(u.begin(), u.end(), v.begin(), c.begin(), std::multiplies<value_type>());
+                if (&a == &b) {
+                    std::transform(u.begin(), u.end(), u.begin(), u.begin(), std::multiplies<value_type>());
+                } else {
+                    Range v(n, value_type::zero());
+                    std::copy(b.begin(), b.end(), v.begin());
+#ifdef MULTICORE
+                    detail::basic_parallel_radix2_fft<FieldType>(v, omega);
+#else
+                    detail::basic_serial_radix2_fft<FieldType>(v, omega);
+#endif
+                    std::transform(u.begin(), u.end(), v.begin(), u.begin(), std::multiplies<value_type>());
+                }
 
 #ifdef MULTICORE
-                detail::basic_parallel_radix2_fft<FieldType>(c, omega.inversed());
+                detail::basic_parallel_radix2_fft<FieldType>(u, omega.inversed());
 #else
-                detail::basic_serial_radix2_fft<FieldType>(c, omega.inversed());
+                detail::basic_serial_radix2_fft<FieldType>(u, omega.inversed());
 #endif
 
                 const value_type sconst = value_type(n).inversed();
-                std::transform(c.begin(),
-                               c.end(),
-                               c.begin(),
+                std::transform(u.begin(),
+                               u.end(),
+                               u.begin(),
                                std::bind(std::multiplies<value_type>(), sconst, std::placeholders::_1));
+                c = std::move(u);
                 condense(c);
             }
 
+            namespace detail {
+                /*
+                 * Vector the coefficients of a Range result are computed in. It uses the allocator of Range when
+                 * Range has one, so that the result can take over its buffer.
+                 */
+                template<typename Range, typename = void>
+                struct coefficient_buffer {
+                    typedef std::vector<
+                        typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type>
+                        type;
+                };
+
+                template<typename Range>
+                struct coefficient_buffer<Range, std::void_t<typename Range::allocator_type>> {
+                    typedef std::vector<
+                        typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type,
+                        typename Range::allocator_type>
+                        type;
+                };
+
+                /*
+                 * Store coefficients computed in a vector into c, taking over the buffer whenever c can be built
+                 * from the vector itself.
+                 */
+                template<typename Range, typename Vector>
+                void assign_coefficients(Range &c, Vector &&v, std::true_type) {
+                    c = Range(std::move(v));
+                }
+
+                template<typename Range, typename Vector>
+                void assign_coefficients(Range &c, Vector &&v, std::false_type) {
+                    c.resize(v.size());
+                    std::copy(v.begin(), v.end(), std::begin(c));
+                }
+
+                template<typename Range, typename Vector>
+                void assign_coefficients(Range &c, Vector &&v) {
+                    assign_coefficients(c, std::move(v), typename std::is_constructible<Range, Vector &&>::type());
+                }
+            }    // namespace detail
+
             /**
              * Perform the multiplication of two polynomials, polynomial A * polynomial B, and stores result
-             * in polynomial C.
+             * in polynomial C. Small operands are multiplied by the schoolbook method, medium ones by Karatsuba
+             * or Toom-3 and large ones by FFT, see detail::multiply_add. C may alias A or B, and passing the
+             * same polynomial as A and B squares it at a lower cost.
              */
             template<typename Range>
             void multiplication(Range &c, const Range &a, const Range &b) {
-                fft_multiplication(c, a, b);
+
+                typedef
+                    typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
+
+                const std::size_t a_size = std::distance(std::begin(a), std::end(a));
+                const std::size_t b_size = std::distance(std::begin(b), std::end(b));
+                if (a_size == 0 || b_size == 0) {
+                    c.resize(1);
+                    c[0] = value_type::zero();
+                    return;
+                }
+
+                typename detail::coefficient_buffer<Range>::type product(a_size + b_size - 1, value_type::zero());
+                detail::multiply_add(product.data(), &*std::begin(a), a_size, &*std::begin(b), b_size);
+
+                detail::assign_coefficients(c, std::move(product));
+                condense(c);
+            }
+
+            /**
+             * Perform the multiplication of polynomial A by a polynomial B given by its FFT image b_fft, i.e. by
+             * the evaluations of B at the powers of unity_root(n) with n = b_fft.size(), and stores the result
+             * modulo (x^n - 1) in polynomial C. The caller chooses n >= deg(A) + deg(B) + 1 for the exact product.
+             * This lets a constant operand be transformed once and reused, so only two FFTs are spent per call.
+             */
+            template<typename Range, typename TransformRange>
+            void transformed_multiplication(Range &c, const Range &a, const TransformRange &b_fft) {
+
+                typedef
+                    typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
+
+                typedef typename value_type::field_type FieldType;
+                BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+                BOOST_STATIC_ASSERT(std::is_same<typename FieldType::value_type, value_type>::value);
+
+                const std::size_t n = b_fft.size();
+                if (a.size() > n) {
+                    throw std::invalid_argument("expected a.size() <= b_fft.size()");
+                }
+                const value_type omega = unity_root<FieldType>(n);
+
+                c = a;
+                c.resize(n, value_type::zero());
+
+#ifdef MULTICORE
+                detail::basic_parallel_radix2_fft<FieldType>(c, omega);
+#else
+                detail::basic_serial_radix2_fft<FieldType>(c, omega);
+#endif
+
+                std::transform(c.begin(), c.end(), b_fft.begin(), c.begin(), std::multiplies<value_type>());
+
+#ifdef MULTICORE
+                detail::basic_parallel_radix2_fft<FieldType>(c, omega.inversed());
+#else
+                detail::basic_serial_radix2_fft<FieldType>(c, omega.inversed());
+#endif
+
+                const value_type sconst = value_type(n).inversed();
+                std::transform(c.begin(),
+                               c.end(),
+                               c.begin(),
+                               std::bind(std::multiplies<value_type>(), sconst, std::placeholders::_1));
+                condense(c);
             }
 
             /**
@@ -221,7 +586,223 @@ namespace nil {
             }
 
             /**
-             * Perform the standard Euclidean Division algorithm.
+             * Compute the inverse of the power series F modulo x^n by Newton iteration, G <- G * (2 - F * G),
+             * which doubles the precision of G at every step.
+             * Input: Polynomial F with F(0) != 0.
+             * Output: Polynomial G of size n, such that F * G = 1 mod x^n.
+             */
+            template<typename Range>
+            Range power_series_inverse(const Range &f, std::size_t n) {
+
+                typedef
+                    typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
+
+                if (f.size() == 0 || f[0] == value_type::zero()) {
+                    throw std::invalid_argument("expected f[0] != 0");
+                }
+
+                /* The scratch vectors hold up to 2n - 1 coefficients and are reused across the iterations */
+                typename detail::coefficient_buffer<Range>::type g(1, f[0].inversed());
+                typename detail::coefficient_buffer<Range>::type t;
+                detail::scratch_vector<value_type> e;
+                g.reserve(2 * n);
+                e.reserve(2 * n);
+                t.reserve(2 * n);
+
+                const std::size_t f_size = f.size();
+                std::size_t k = 1;
+                while (k < n) {
+                    k = std::min(2 * k, n);
+
+                    const std::size_t f_k = std::min(f_size, k);
+                    e.assign(f_k + g.size() - 1, value_type::zero());
+                    detail::multiply_add(e.data(), &*std::begin(f), f_k, g.data(), g.size());
+                    e.resize(k, value_type::zero());
+
+                    std::transform(e.begin(), e.end(), e.begin(), std::negate<value_type>());
+                    e[0] += value_type(2);
+
+                    t.assign(g.size() + k - 1, value_type::zero());
+                    detail::multiply_add(t.data(), g.data(), g.size(), e.data(), k);
+                    t.resize(k, value_type::zero());
+                    g.swap(t);
+                }
+
+                g.resize(n, value_type::zero());
+                Range result;
+                detail::assign_coefficients(result, std::move(g));
+                return result;
+            }
+
+            namespace detail {
+                /*
+                 * Quotients and divisors of at least this many coefficients are divided through the power series
+                 * inverse of the reversed divisor, smaller ones by long division.
+                 */
+                constexpr std::size_t newton_division_threshold = 64;
+
+                /*
+                 * Divisors with at most this many nonzero coefficients below the leading one are divided term by
+                 * term in O(a_size * terms), see sparse_divide.
+                 */
+                constexpr std::size_t sparse_division_terms = 16;
+
+                /*
+                 * Indices of the nonzero coefficients of a sparse divisor, one more than sparse_division_terms
+                 * is ever collected.
+                 */
+                typedef boost::container::small_vector<std::size_t, sparse_division_terms + 1> sparse_terms;
+
+                /*
+                 * Columns of the binomial division handled by one thread at a time.
+                 */
+                constexpr std::size_t binomial_division_block_size = 1 << 12;
+
+                /*
+                 * Divide w of size m by x^n - c in place: afterwards w[0, n) holds the remainder and w[n, m) the
+                 * quotient. Coefficient i only feeds i - n, so every column j of w viewed as rows of n is an
+                 * independent recurrence, and column blocks are spread over threads when built with MULTICORE.
+                 */
+                template<typename ValueType>
+                void binomial_divide(ValueType *w, std::size_t m, std::size_t n, const ValueType &c) {
+                    if (m <= n) {
+                        return;
+                    }
+                    const bool unit = c == ValueType::one();
+                    const std::size_t rows = (m + n - 1) / n;
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t start = 0; start < n; start += binomial_division_block_size) {
+                        const std::size_t end = std::min(start + binomial_division_block_size, n);
+                        for (std::size_t t = rows - 1; t > 0; --t) {
+                            ValueType *row = w + t * n;
+                            ValueType *below = row - n;
+                            const std::size_t last = std::min(end, m - t * n);
+                            if (unit) {
+                                for (std::size_t j = start; j < last; ++j) {
+                                    below[j] += row[j];
+                                }
+                            } else {
+                                for (std::size_t j = start; j < last; ++j) {
+                                    below[j] += c * row[j];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Long division by b touching only its nonzero coefficients, given by their indices below the
+                 * leading one. Divisors b_d x^d + b_0 go through binomial_divide.
+                 */
+                template<typename Vector, typename ValueType>
+                void sparse_divide(Vector &q,
+                                   Vector &r,
+                                   const ValueType *a,
+                                   std::size_t a_size,
+                                   const ValueType *b,
+                                   std::size_t b_size,
+                                   const sparse_terms &terms) {
+                    const std::size_t d = b_size - 1;
+                    const ValueType lead_inverse = b[d].inversed();
+
+                    r.assign(a, a + a_size);
+                    if (terms.size() <= 1 && (terms.empty() || terms[0] == 0)) {
+                        const ValueType c = terms.empty() ? ValueType::zero() : -b[0] * lead_inverse;
+                        if (d > 0) {
+                            binomial_divide(r.data(), a_size, d, c);
+                        }
+                        q.assign(r.begin() + d, r.end());
+                        if (lead_inverse != ValueType::one()) {
+                            for (ValueType &u : q) {
+                                u *= lead_inverse;
+                            }
+                        }
+                    } else {
+                        q.assign(a_size - d, ValueType::zero());
+                        for (std::size_t s = a_size; s-- > d;) {
+                            const ValueType lead_coeff = r[s] * lead_inverse;
+                            q[s - d] = lead_coeff;
+                            for (std::size_t j : terms) {
+                                r[s - d + j] -= lead_coeff * b[j];
+                            }
+                        }
+                    }
+                    r.resize(d);
+                }
+
+                /*
+                 * Divide a by b, where b has a nonzero leading coefficient: q gets the a_size - b_size + 1
+                 * coefficients of the quotient and r the b_size - 1 low coefficients of the remainder.
+                 */
+                template<typename Vector, typename ValueType>
+                void divide(Vector &q,
+                            Vector &r,
+                            const ValueType *a,
+                            std::size_t a_size,
+                            const ValueType *b,
+                            std::size_t b_size) {
+                    const std::size_t d = b_size - 1;
+                    const std::size_t k = a_size - d;
+
+                    sparse_terms terms;
+                    for (std::size_t j = 0; j < d && terms.size() <= sparse_division_terms; j++) {
+                        if (b[j] != ValueType::zero()) {
+                            terms.push_back(j);
+                        }
+                    }
+                    if (terms.size() <= sparse_division_terms) {
+                        sparse_divide(q, r, a, a_size, b, b_size, terms);
+                        return;
+                    }
+
+                    if (k <= newton_division_threshold || b_size <= newton_division_threshold) {
+                        const ValueType c = b[d].inversed();
+                        r.assign(a, a + a_size);
+                        q.assign(k, ValueType::zero());
+                        for (std::size_t s = a_size; s-- > d;) {
+                            const ValueType lead_coeff = r[s] * c;
+                            q[s - d] = lead_coeff;
+                            for (std::size_t u = 0; u < d; u++) {
+                                r[s - d + u] -= lead_coeff * b[u];
+                            }
+                        }
+                        r.resize(d);
+                        return;
+                    }
+
+                    /* rev(q) = rev(a) / rev(b) mod x^k, where rev reverses the coefficients */
+                    scratch_vector<ValueType> rev_b(std::min(k, b_size));
+                    for (std::size_t u = 0; u < rev_b.size(); u++) {
+                        rev_b[u] = b[d - u];
+                    }
+                    scratch_vector<ValueType> rev_a(k);
+                    for (std::size_t u = 0; u < k; u++) {
+                        rev_a[u] = a[a_size - 1 - u];
+                    }
+
+                    const scratch_vector<ValueType> rev_b_inverse = power_series_inverse(rev_b, k);
+                    scratch_vector<ValueType> rev_q(2 * k - 1, ValueType::zero());
+                    multiply_add(rev_q.data(), rev_a.data(), k, rev_b_inverse.data(), k);
+                    q.assign(std::make_reverse_iterator(rev_q.begin() + k), rev_q.rend());
+
+                    /* Only the low d coefficients of q * b are needed for the remainder */
+                    const std::size_t q_low = std::min(k, d);
+                    scratch_vector<ValueType> qb(q_low + d - 1, ValueType::zero());
+                    multiply_add(qb.data(), q.data(), q_low, b, d);
+                    r.resize(d);
+                    for (std::size_t u = 0; u < d; u++) {
+                        r[u] = a[u] - qb[u];
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * Perform the Euclidean Division algorithm. Divisors with few nonzero coefficients, such as x^n - c,
+             * are divided term by term in linear time. Otherwise long division is used for small operands,
+             * larger ones are divided in O(M(n)) through power_series_inverse.
              * Input: Polynomial A, Polynomial B, where A / B
              * Output: Polynomial Q, Polynomial R, such that A = (Q * B) + R.
              */
@@ -231,34 +812,177 @@ namespace nil {
                 typedef
                     typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
 
-                std::size_t d = b.size() - 1;       /* Degree of B */
-                value_type c = b.back().inversed(); /* Inverse of Leading Coefficient of B */
+                detail::scratch_vector<value_type> u(std::begin(a), std::end(a));
+                detail::scratch_vector<value_type> v(std::begin(b), std::end(b));
+                condense(u);
+                condense(v);
+                if (is_zero(v)) {
+                    throw std::invalid_argument("division by the zero polynomial");
+                }
 
-                r = Range(a);
-                q = Range(r.size(), value_type::zero());
+                typename detail::coefficient_buffer<Range>::type quotient(1, value_type::zero());
+                typename detail::coefficient_buffer<Range>::type remainder;
+                if (u.size() < v.size()) {
+                    remainder.assign(u.begin(), u.end());
+                } else {
+                    detail::divide(quotient, remainder, u.data(), u.size(), v.data(), v.size());
+                }
+                if (remainder.empty()) {
+                    remainder.push_back(value_type::zero());
+                }
+                condense(quotient);
+                condense(remainder);
 
-                std::size_t r_deg = r.size() - 1;
-                std::size_t shift;
+                detail::assign_coefficients(q, std::move(quotient));
+                detail::assign_coefficients(r, std::move(remainder));
+            }
 
-                while (r_deg >= d && !is_zero(r)) {
-                    if (r_deg >= d)
-                        shift = r_deg - d;
-                    else
-                        shift = 0;
+            namespace detail {
+                /*
+                 * Divisions by x - z of at least this many coefficients are run as a blocked scan when built
+                 * with MULTICORE, in blocks of synthetic_division_block_size.
+                 */
+                constexpr std::size_t parallel_synthetic_division_threshold = 1 << 16;
+                constexpr std::size_t synthetic_division_block_size = 1 << 12;
+
+                /*
+                 * Write the n - 1 coefficients of f / (x - z) to q and return the remainder f(z), by
+                 * q_{i - 1} = f_i + z * q_i starting from q_{n - 2} = f_{n - 1}. q may alias f.
+                 */
+                template<typename ValueType>
+                ValueType synthetic_division(ValueType *q, const ValueType *f, std::size_t n, const ValueType &z) {
+                    if (n == 0) {
+                        return ValueType::zero();
+                    }
 
-                    value_type lead_coeff = r.back() * c;
+#ifdef MULTICORE
+                    if (n >= parallel_synthetic_division_threshold) {
+                        /*
+                         * Each block [s, e) of f is divided on its own as if q_{e - 1} were zero. The true values
+                         * differ by z^{e - i} * q_{e - 1}, so the carries are propagated from the top block down
+                         * and then added back in parallel. q_{s - 1} is only written in the second pass, as it
+                         * may alias the last coefficient of the block below.
+                         */
+                        const std::size_t block = synthetic_division_block_size;
+                        const std::size_t blocks = (n + block - 1) / block;
+                        scratch_vector<ValueType> low(blocks);
+                        scratch_vector<ValueType> high(blocks);
+
+#pragma omp parallel for schedule(static)
+                        for (std::size_t b = 0; b < blocks; ++b) {
+                            const std::size_t s = b * block;
+                            const std::size_t e = std::min(s + block, n);
+                            ValueType acc = f[e - 1];
+                            for (std::size_t i = e - 1; i > s; --i) {
+                                const ValueType c = f[i - 1];
+                                q[i - 1] = acc;
+                                acc = c + z * acc;
+                            }
+                            low[b] = acc;
+                        }
+
+                        /* high[b] = q_{e - 1} is the carry into block b and low[b] becomes q_{s - 1} */
+                        const ValueType z_block = z.pow(block);
+                        ValueType carry = ValueType::zero();
+                        for (std::size_t b = blocks; b-- > 0;) {
+                            high[b] = carry;
+                            const std::size_t size = std::min(b * block + block, n) - b * block;
+                            carry = low[b] + (size == block ? z_block : z.pow(size)) * carry;
+                            low[b] = carry;
+                        }
+
+#pragma omp parallel for schedule(static)
+                        for (std::size_t b = 0; b < blocks; ++b) {
+                            const std::size_t s = b * block;
+                            const std::size_t e = std::min(s + block, n);
+                            ValueType correction = high[b];
+                            for (std::size_t i = e - 1; i > s; --i) {
+                                correction *= z;
+                                q[i - 1] += correction;
+                            }
+                            if (s > 0) {
+                                q[s - 1] = low[b];
+                            }
+                        }
+                        return carry;
+                    }
+#endif
 
-                    q[shift] += lead_coeff;
+                    ValueType acc = f[n - 1];
+                    for (std::size_t i = n - 1; i > 0; --i) {
+                        const ValueType c = f[i - 1];
+                        q[i - 1] = acc;
+                        acc = c + z * acc;
+                    }
+                    return acc;
+                }
+            }    // namespace detail
 
-                    if (b.size() + shift + 1 > r.size())
-                        r.resize(b.size() + shift + 1);
-                    auto glambda = [=](value_type x, value_type y) { return y - (x * lead_coeff); };
-                    std::transform(b.begin(), b.end(), r.begin() + shift, r.begin() + shift, glambda);
-                    condense(r);
+            /**
+             * Divide polynomial F by x^n - c in linear time, e.g. by the vanishing polynomial x^n - 1 of a
+             * multiplicative subgroup or x^n - g^n of its coset. Stores the quotient in Q and the remainder in R.
+             */
+            template<typename Range, typename FieldValueType>
+            void divide_by_binomial(Range &q, Range &r, const Range &f, std::size_t n, const FieldValueType &c) {
+                if (n == 0) {
+                    throw std::invalid_argument("expected n > 0");
+                }
+
+                typename detail::coefficient_buffer<Range>::type w(std::begin(f), std::end(f));
+                typename detail::coefficient_buffer<Range>::type quotient(1, FieldValueType::zero());
+                if (w.size() > n) {
+                    detail::binomial_divide(w.data(), w.size(), n, c);
+                    quotient.assign(w.begin() + n, w.end());
+                    w.resize(n);
+                }
+                if (w.empty()) {
+                    w.push_back(FieldValueType::zero());
+                }
+                condense(quotient);
+                condense(w);
+
+                detail::assign_coefficients(q, std::move(quotient));
+                detail::assign_coefficients(r, std::move(w));
+            }
 
-                    r_deg = r.size() - 1;
+            /**
+             * Divide polynomial F by x - z in linear time: stores the quotient in Q and returns the remainder,
+             * which is F(z). Q may alias F.
+             */
+            template<typename Range, typename FieldValueType>
+            FieldValueType synthetic_division(Range &q, const Range &f, const FieldValueType &z) {
+                const std::size_t n = std::distance(std::begin(f), std::end(f));
+                if (n <= 1) {
+                    const FieldValueType r = n == 0 ? FieldValueType::zero() : *std::begin(f);
+                    q.resize(1);
+                    *std::begin(q) = FieldValueType::zero();
+                    return r;
                 }
+
+                typename detail::coefficient_buffer<Range>::type quotient(n - 1);
+                const FieldValueType r = detail::synthetic_division(quotient.data(), &*std::begin(f), n, z);
+                detail::assign_coefficients(q, std::move(quotient));
                 condense(q);
+                return r;
+            }
+
+            /**
+             * Divide every polynomial of F by the same x - z: stores the quotients in Q and returns the
+             * remainders F_k(z). The polynomials are divided in parallel when built with MULTICORE.
+             */
+            template<typename Range, typename FieldValueType>
+            std::vector<FieldValueType>
+                batch_synthetic_division(std::vector<Range> &q, const std::vector<Range> &f, const FieldValueType &z) {
+                std::vector<FieldValueType> r(f.size());
+                q.resize(f.size());
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                for (std::size_t k = 0; k < f.size(); ++k) {
+                    r[k] = synthetic_division(q[k], f[k], z);
+                }
+                return r;
             }
         }    // namespace math
     }        // namespace crypto3
@@ -29,7 +29,10 @@
 #include <algorithm>
 #include <vector>
 
+#include <nil/crypto3/math/detail/arena.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/small_polynomial.hpp>
+#include <nil/crypto3/math/polynomial/subproduct_tree.hpp>
 #include <nil/crypto3/math/polynomial/xgcd.hpp>
 
 namespace nil {
@@ -37,50 +40,19 @@ namespace nil {
         namespace math {
 
             /**
-             * Compute the Subproduct Tree of degree 2^M and store it in Tree T.
-             * Below we make use of the Subproduct Tree description from
-             * [Bostan and Schost 2005. Polynomial Evaluation and Interpolation on Special Sets of Points], on
-             * page 7.
+             * Compute the Subproduct Tree of degree 2^M on the points 0, 1, ..., 2^M - 1 and store it in Tree T.
              */
             template<typename FieldType>
-            void compute_subproduct_tree(std::vector<std::vector<std::vector<typename FieldType::value_type>>> &T,
-                                         std::size_t m) {
+            void compute_subproduct_tree(subproduct_tree<FieldType> &T, std::size_t m) {
 
                 typedef typename FieldType::value_type value_type;
 
-                if (T.size() != m + 1)
-                    T.resize(m + 1);
-
-                /*
-                 * Subproduct tree T is represented as a 2-dimensional array T_{i, j}.
-                 * T_{i, j} = product_{l = [2^i * j] to [2^i * (j+1) - 1]} (x - x_l)
-                 * Note: n = 2^m.
-                 */
-
-                /* Precompute the first row. */
-                T[0] = std::vector<std::vector<value_type>>(1u << m);
+                std::vector<value_type> points(1u << m);
                 for (std::size_t j = 0; j < (1u << m); j++) {
-                    T[0][j] = std::vector<value_type>(2, value_type::one());
-                    T[0][j][0] = value_type(-j);
+                    points[j] = value_type(j);
                 }
 
-                std::vector<value_type> a;
-                std::vector<value_type> b;
-
-                std::size_t index = 0;
-                for (std::size_t i = 1; i <= m; i++) {
-                    T[i] = std::vector<std::vector<value_type>>(1u << (m - i));
-                    for (std::size_t j = 0; j < (1u << (m - i)); j++) {
-                        a = T[i - 1][index];
-                        index++;
-
-                        b = T[i - 1][index];
-                        index++;
-
-                        multiplication(T[i][j], a, b);
-                    }
-                    index = 0;
-                }
+                T.build(points);
             }
 
             /**
@@ -90,19 +62,17 @@ namespace nil {
              * 12 and 14.
              */
             template<typename FieldType, typename Range>
-            void monomial_to_newton_basis(Range &a,
-                                         const std::vector<std::vector<std::vector<typename FieldType::value_type>>> &T,
-                                         size_t n) {
+            void monomial_to_newton_basis(Range &a, const subproduct_tree<FieldType> &T, size_t n) {
 
                 typedef typename FieldType::value_type value_type;
                 static_assert(std::is_same<typename Range::value_type, value_type>::value);
 
                 std::size_t m = log2(n);
-                // if (T.size() != m + 1u)
-                // throw DomainSizeException("expected T.size() == m + 1");
+                // if (T.depth() != m)
+                // throw DomainSizeException("expected T.depth() == m");
 
                 /* MonomialToNewton */
-                std::vector<value_type> I(T[m][0]);
+                std::vector<value_type> I(T.root());
                 reverse(I, n);
 
                 std::vector<value_type> mod(n + 1, value_type::zero());
@@ -124,12 +94,12 @@ namespace nil {
                 /* NB: unsigned reverse iteration: cannot do i >= 0, but can do i < m
                    because unsigned integers are guaranteed to wrap around */
                 for (std::size_t i = m - 1; i < m; i--) {
-                    row_length = T[i].size() - 1;
+                    row_length = T.nodes(i) - 1;
                     c_vec = 1u << i;
 
                     /* NB: unsigned reverse iteration */
                     for (std::size_t j = (1u << (m - i - 1)) - 1; j < (1u << (m - i - 1)); j--) {
-                        c[2 * j + 1] = transpose_multiplication((1u << i) - 1, T[i][row_length - 2 * j], c[j]);
+                        c[2 * j + 1] = transpose_multiplication((1u << i) - 1, T.node(i, row_length - 2 * j), c[j]);
                         c[2 * j] = c[j];
                         c[2 * j].resize(c_vec);
                     }
@@ -150,33 +120,34 @@ namespace nil {
              * page 11.
              */
             template<typename FieldType, typename Range>
-            void
-                newton_to_monomial_basis(Range &a,
-                                         const std::vector<std::vector<std::vector<typename FieldType::value_type>>> &T,
-                                         size_t n) {
+            void newton_to_monomial_basis(Range &a, const subproduct_tree<FieldType> &T, size_t n) {
 
                 typedef typename FieldType::value_type value_type;
                 static_assert(std::is_same<typename Range::value_type, value_type>::value);
 
                 std::size_t m = log2(n);
-                // if (T.size() != m + 1u)
-                // throw DomainSizeException("expected T.size() == m + 1");
+                // if (T.depth() != m)
+                // throw DomainSizeException("expected T.depth() == m");
 
-                std::vector<std::vector<value_type>> f(n);
+                /* The low levels, which hold most of the nodes, fit in the inline storage */
+                std::vector<small_polynomial<value_type>> f(n);
                 for (std::size_t i = 0; i < n; i++) {
-                    f[i] = std::vector<value_type>(1, a[i]);
+                    f[i] = small_polynomial<value_type>(a[i]);
                 }
 
                 /* NewtonToMonomial */
-                std::vector<value_type> temp(1, value_type::zero());
                 for (std::size_t i = 0; i < m; i++) {
                     for (std::size_t j = 0; j < (1u << (m - i - 1)); j++) {
-                        multiplication(temp, T[i][2 * j], f[2 * j + 1]);
-                        addition(f[j], f[2 * j], temp);
+                        const value_type *low = T.node_data(i, 2 * j);
+                        small_polynomial<value_type> node(low, low + T.node_degree(i, 2 * j));
+                        node.push_back(value_type::one());
+                        small_polynomial<value_type> product = node * f[2 * j + 1];
+                        product += f[2 * j];
+                        f[j].swap(product);
                     }
                 }
 
-                a = f[0];
+                a.assign(f[0].begin(), f[0].end());
             }
 
             /**
@@ -192,10 +163,10 @@ namespace nil {
 
                 typedef typename FieldType::value_type value_type;
 
-                std::vector<value_type> u(n, value_type::zero());
-                std::vector<value_type> w(n, value_type::zero());
-                std::vector<value_type> z(n, value_type::zero());
-                std::vector<value_type> f(n, value_type::zero());
+                detail::scratch_vector<value_type> u(n, value_type::zero());
+                detail::scratch_vector<value_type> w(n, value_type::zero());
+                detail::scratch_vector<value_type> z(n, value_type::zero());
+                detail::scratch_vector<value_type> f(n, value_type::zero());
                 u[0] = value_type::one();
                 w[0] = a[0];
                 z[0] = value_type::one();
@@ -236,10 +207,10 @@ namespace nil {
 
                 typedef typename FieldType::value_type value_type;
 
-                std::vector<value_type> v(n, value_type::zero());
-                std::vector<value_type> u(n, value_type::zero());
-                std::vector<value_type> w(n, value_type::zero());
-                std::vector<value_type> z(n, value_type::zero());
+                detail::scratch_vector<value_type> v(n, value_type::zero());
+                detail::scratch_vector<value_type> u(n, value_type::zero());
+                detail::scratch_vector<value_type> w(n, value_type::zero());
+                detail::scratch_vector<value_type> z(n, value_type::zero());
                 v[0] = a[0];
                 u[0] = value_type::one();
                 w[0] = a[0];
@@ -27,10 +27,18 @@
 #define CRYPTO3_MATH_EVALUATE_HPP
 
 #include <algorithm>
+#include <stdexcept>
 #include <vector>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <boost/math/tools/polynomial.hpp>
 
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace math {
@@ -108,6 +116,315 @@ namespace nil {
 
                 return evaluate_lagrange_polynomial(domain.begin(), domain.end(), t, m, idx);
             }
+
+            namespace detail {
+                /*
+                 * Long polynomials are evaluated in blocks of this many coefficients, in parallel when built
+                 * with MULTICORE. Must be a power of two.
+                 */
+                constexpr std::size_t evaluation_block_size = 1024;
+
+                /*
+                 * Horner's rule run as four interleaved chains in x^4, so that consecutive multiplications do not
+                 * wait on each other.
+                 */
+                template<typename FieldValueType>
+                FieldValueType horner(const FieldValueType *a, std::size_t n, const FieldValueType &x) {
+                    const FieldValueType x2 = x.squared();
+                    const FieldValueType x4 = x2.squared();
+                    const std::size_t m = n - n % 4;
+
+                    FieldValueType r[4];
+                    for (std::size_t k = 0; k < 4; ++k) {
+                        r[k] = m + k < n ? a[m + k] : FieldValueType::zero();
+                    }
+                    for (std::size_t i = m; i != 0;) {
+                        i -= 4;
+                        r[0] = r[0] * x4 + a[i];
+                        r[1] = r[1] * x4 + a[i + 1];
+                        r[2] = r[2] * x4 + a[i + 2];
+                        r[3] = r[3] * x4 + a[i + 3];
+                    }
+                    return r[0] + x * (r[1] + x * (r[2] + x * r[3]));
+                }
+
+                /*
+                 * Each block of evaluation_block_size coefficients is evaluated on its own, the block values are
+                 * then combined by Horner's rule in x^evaluation_block_size.
+                 */
+                template<typename FieldValueType>
+                FieldValueType evaluate_blocks(const FieldValueType *a, std::size_t n, const FieldValueType &x) {
+                    if (n <= evaluation_block_size) {
+                        return horner(a, n, x);
+                    }
+
+                    const std::size_t blocks = (n + evaluation_block_size - 1) / evaluation_block_size;
+                    std::vector<FieldValueType> partial(blocks);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t j = 0; j < blocks; ++j) {
+                        const std::size_t start = j * evaluation_block_size;
+                        partial[j] = horner(a + start, std::min(evaluation_block_size, n - start), x);
+                    }
+
+                    FieldValueType x_block = x;
+                    for (std::size_t k = 1; k < evaluation_block_size; k <<= 1) {
+                        x_block = x_block.squared();
+                    }
+                    return horner(partial.data(), blocks, x_block);
+                }
+
+                /*
+                 * Points are evaluated in tiles of this many, with one accumulator per point of the tile, so
+                 * the coefficients are streamed once per tile.
+                 */
+                constexpr std::size_t evaluation_tile_size = 16;
+
+                /*
+                 * Horner's rule at count <= evaluation_tile_size points at once. The chains of the points are
+                 * independent, which hides the latency of the multiplications.
+                 */
+                template<typename FieldValueType>
+                void horner_tile(const FieldValueType *a,
+                                 std::size_t n,
+                                 const FieldValueType *x,
+                                 std::size_t count,
+                                 FieldValueType *out) {
+                    FieldValueType points[evaluation_tile_size];
+                    FieldValueType acc[evaluation_tile_size];
+                    for (std::size_t k = 0; k < count; ++k) {
+                        points[k] = x[k];
+                        acc[k] = FieldValueType::zero();
+                    }
+                    for (std::size_t i = n; i-- > 0;) {
+                        const FieldValueType c = a[i];
+                        for (std::size_t k = 0; k < count; ++k) {
+                            acc[k] = acc[k] * points[k] + c;
+                        }
+                    }
+                    std::copy(acc, acc + count, out);
+                }
+
+                /*
+                 * Sum of a[i] * b[i], by blocks in parallel when built with MULTICORE.
+                 */
+                template<typename FieldValueType>
+                FieldValueType inner_product(const FieldValueType *a, const FieldValueType *b, std::size_t n) {
+                    const std::size_t blocks = (n + evaluation_block_size - 1) / evaluation_block_size;
+                    std::vector<FieldValueType> partial(blocks, FieldValueType::zero());
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t j = 0; j < blocks; ++j) {
+                        const std::size_t end = std::min((j + 1) * evaluation_block_size, n);
+                        FieldValueType sum = FieldValueType::zero();
+                        for (std::size_t i = j * evaluation_block_size; i < end; ++i) {
+                            sum += a[i] * b[i];
+                        }
+                        partial[j] = sum;
+                    }
+
+                    FieldValueType result = FieldValueType::zero();
+                    for (std::size_t j = 0; j < blocks; ++j) {
+                        result += partial[j];
+                    }
+                    return result;
+                }
+
+                /*
+                 * Barycentric weights of the n-th roots of unity at t: the polynomial of degree < n taking the
+                 * values y_i at omega^i is sum y_i * w_i times the returned factor. With
+                 * w_i = omega^i / (t - omega^i) the factor is (t^n - 1) / n; when t is itself a root of unity
+                 * the weights select its value and the factor is one.
+                 */
+                template<typename FieldType>
+                typename FieldType::value_type barycentric_weights(std::vector<typename FieldType::value_type> &w,
+                                                                   std::size_t n,
+                                                                   const typename FieldType::value_type &t) {
+                    typedef typename FieldType::value_type value_type;
+
+                    const value_type omega = unity_root<FieldType>(n);
+                    const value_type t_n = t.pow(n) - value_type::one();
+                    w.assign(n, value_type::zero());
+
+                    if (t_n == value_type::zero()) {
+                        value_type omega_i = value_type::one();
+                        for (std::size_t i = 0; i < n; ++i, omega_i *= omega) {
+                            if (omega_i == t) {
+                                w[i] = value_type::one();
+                                break;
+                            }
+                        }
+                        return value_type::one();
+                    }
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t start = 0; start < n; start += evaluation_block_size) {
+                        const std::size_t end = std::min(start + evaluation_block_size, n);
+                        std::vector<value_type> d(end - start);
+                        value_type omega_i = omega.pow(start);
+                        for (std::size_t i = start; i < end; ++i, omega_i *= omega) {
+                            w[i] = omega_i;
+                            d[i - start] = t - omega_i;
+                        }
+                        batch_inversion(d);
+                        for (std::size_t i = start; i < end; ++i) {
+                            w[i] *= d[i - start];
+                        }
+                    }
+                    return t_n * value_type(n).inversed();
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief
+             * Evaluation of a polynomial given by its coefficients at t. Long polynomials are cut into blocks
+             * evaluated independently, in parallel when built with MULTICORE, and joined through the powers of
+             * t^evaluation_block_size.
+             */
+            template<typename Range, typename FieldValueType>
+            FieldValueType evaluate_at(const Range &coefficients, const FieldValueType &t) {
+                const std::size_t n = std::distance(std::begin(coefficients), std::end(coefficients));
+                if (n == 0) {
+                    return FieldValueType::zero();
+                }
+                return detail::evaluate_blocks(&*std::begin(coefficients), n, t);
+            }
+
+            /*!
+             * @brief
+             * Evaluation of a polynomial given by its coefficients at every point of a small set. The points are
+             * taken in tiles evaluated by Horner's rule side by side, in parallel when built with MULTICORE.
+             * Costs n multiplications per point; for many points point_set is asymptotically faster.
+             */
+            template<typename Range1, typename Range2>
+            std::vector<typename std::iterator_traits<decltype(std::begin(std::declval<Range2>()))>::value_type>
+                evaluate_at_points(const Range1 &coefficients, const Range2 &points) {
+                typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range2>()))>::value_type
+                    value_type;
+
+                const std::vector<value_type> x(std::begin(points), std::end(points));
+                const std::size_t n = std::distance(std::begin(coefficients), std::end(coefficients));
+                const std::size_t m = x.size();
+                std::vector<value_type> result(m, value_type::zero());
+                if (n == 0) {
+                    return result;
+                }
+
+                const value_type *a = &*std::begin(coefficients);
+                const std::size_t tile = detail::evaluation_tile_size;
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                for (std::size_t start = 0; start < m; start += tile) {
+                    detail::horner_tile(a, n, x.data() + start, std::min(tile, m - start), result.data() + start);
+                }
+                return result;
+            }
+
+            /*!
+             * @brief
+             * Evaluation of many polynomials given by their coefficients at the same point t in one pass: a block
+             * of the powers of t is computed once and applied to the matching coefficients of every polynomial.
+             */
+            template<typename RangeOfRanges, typename FieldValueType>
+            std::vector<FieldValueType> evaluate_all_at(const RangeOfRanges &polynomials, const FieldValueType &t) {
+                std::vector<const FieldValueType *> coefficients;
+                std::vector<std::size_t> sizes;
+                std::size_t m = 0;
+                for (const auto &p : polynomials) {
+                    sizes.push_back(std::distance(std::begin(p), std::end(p)));
+                    coefficients.push_back(sizes.back() == 0 ? nullptr : &*std::begin(p));
+                    m = std::max(m, sizes.back());
+                }
+
+                const std::size_t count = sizes.size();
+                std::vector<FieldValueType> result(count, FieldValueType::zero());
+                const std::size_t block = detail::evaluation_block_size;
+
+#ifdef MULTICORE
+#pragma omp parallel
+#endif
+                {
+                    std::vector<FieldValueType> sum(count, FieldValueType::zero());
+                    std::vector<FieldValueType> powers(block);
+#ifdef MULTICORE
+#pragma omp for schedule(static)
+#endif
+                    for (std::size_t start = 0; start < m; start += block) {
+                        const std::size_t end = std::min(start + block, m);
+                        powers[0] = t.pow(start);
+                        for (std::size_t i = 1; i < end - start; ++i) {
+                            powers[i] = powers[i - 1] * t;
+                        }
+                        for (std::size_t p = 0; p < count; ++p) {
+                            const FieldValueType *c = coefficients[p];
+                            FieldValueType s = sum[p];
+                            for (std::size_t i = start; i < std::min(end, sizes[p]); ++i) {
+                                s += c[i] * powers[i - start];
+                            }
+                            sum[p] = s;
+                        }
+                    }
+#ifdef MULTICORE
+#pragma omp critical
+#endif
+                    for (std::size_t p = 0; p < count; ++p) {
+                        result[p] += sum[p];
+                    }
+                }
+                return result;
+            }
+
+            /*!
+             * @brief
+             * Evaluation at t of the polynomial of degree < n given by its values at the n-th roots of unity,
+             * n a power of two, by the barycentric formula. Costs O(n) multiplications and one inversion, so
+             * no inverse FFT is needed.
+             */
+            template<typename Range, typename FieldValueType>
+            FieldValueType barycentric_evaluate_at(const Range &evaluations, const FieldValueType &t) {
+                typedef typename FieldValueType::field_type FieldType;
+
+                const std::size_t n = std::distance(std::begin(evaluations), std::end(evaluations));
+                if (n == 0) {
+                    return FieldValueType::zero();
+                }
+                std::vector<FieldValueType> w;
+                const FieldValueType factor = detail::barycentric_weights<FieldType>(w, n, t);
+                return factor * detail::inner_product(&*std::begin(evaluations), w.data(), n);
+            }
+
+            /*!
+             * @brief
+             * Barycentric evaluation at the same point t of many polynomials given by their values at the n-th
+             * roots of unity. The weights are shared by consecutive polynomials of the same size, each of which
+             * then costs n multiplications.
+             */
+            template<typename RangeOfRanges, typename FieldValueType>
+            std::vector<FieldValueType> barycentric_evaluate_all_at(const RangeOfRanges &polynomials,
+                                                                    const FieldValueType &t) {
+                typedef typename FieldValueType::field_type FieldType;
+
+                std::vector<FieldValueType> result;
+                std::vector<FieldValueType> w;
+                FieldValueType factor = FieldValueType::one();
+                for (const auto &p : polynomials) {
+                    const std::size_t n = std::distance(std::begin(p), std::end(p));
+                    if (n == 0) {
+                        result.push_back(FieldValueType::zero());
+                        continue;
+                    }
+                    if (n != w.size()) {
+                        factor = detail::barycentric_weights<FieldType>(w, n, t);
+                    }
+                    result.push_back(factor * detail::inner_product(&*std::begin(p), w.data(), n));
+                }
+                return result;
+            }
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
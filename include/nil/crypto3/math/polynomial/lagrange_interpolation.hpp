@@ -27,15 +27,63 @@
 #ifndef CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 #define CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 
+#include <algorithm>
+#include <vector>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
-#include <nil/crypto3/math/domains/evaluation_domain.hpp>
-#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/multipoint_evaluation.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
-            // Default implementation according to Wikipedia
-            // https://en.wikipedia.org/wiki/Lagrange_polynomial
+            namespace detail {
+                /*
+                 * Interpolation through the subproduct tree in O(M(k) log k): with M the vanishing polynomial of
+                 * the points, the result is sum_i y_i / M'(x_i) * M(x) / (x - x_i), where M' is evaluated at all
+                 * the points at once.
+                 * Below we make use of [Gathen and Gerhard, Modern Computer Algebra 3rd Ed., Section 10.2].
+                 */
+                template<typename FieldValueType, typename Range1, typename Range2>
+                polynomial<FieldValueType> fast_interpolation(const Range1 &xs, const Range2 &ys) {
+                    typedef typename FieldValueType::field_type FieldType;
+
+                    const std::size_t k = std::distance(std::begin(xs), std::end(xs));
+                    if (k != std::size_t(std::distance(std::begin(ys), std::end(ys)))) {
+                        throw std::invalid_argument("expected xs.size() == ys.size()");
+                    }
+                    if (k == 0) {
+                        return polynomial<FieldValueType>();
+                    }
+
+                    point_set<FieldType> S(xs);
+
+                    const std::vector<FieldValueType> M = S.tree().root();
+                    std::vector<FieldValueType> dM(k);
+                    for (std::size_t i = 0; i < k; ++i) {
+                        dM[i] = FieldValueType(i + 1) * M[i + 1];
+                    }
+
+                    std::vector<FieldValueType> c = S.evaluate(dM);
+                    if (std::any_of(c.begin(), c.end(), [](const FieldValueType &e) { return e.is_zero(); })) {
+                        throw std::invalid_argument("expected pairwise distinct points");
+                    }
+
+                    batch_inversion(c);
+
+                    auto y = std::begin(ys);
+                    for (std::size_t i = 0; i < k; ++i, ++y) {
+                        c[i] *= *y;
+                    }
+
+                    std::vector<FieldValueType> r = S.tree().linear_combination(c);
+
+                    polynomial<FieldValueType> result(r.begin(), r.end());
+                    result.condense();
+                    return result;
+                }
+            }    // namespace detail
+
             template<typename InputRange,
                      typename FieldValueType =
                          typename std::iterator_traits<typename InputRange::iterator>::value_type::first_type>
@@ -45,20 +93,33 @@ namespace nil {
                 polynomial<FieldValueType>>::type
                 lagrange_interpolation(const InputRange &points) {
 
-                std::size_t k = std::size(points);
-
-                polynomial<FieldValueType> result;
-                for (std::size_t j = 0; j < k; ++j) {
-                    polynomial<FieldValueType> term({points[j].second});
-                    for (std::size_t m = 0; m < k; ++m) {
-                        if (m != j) {
-                            term = term * (polynomial<FieldValueType>({-points[m].first, FieldValueType::one()}) /
-                                           polynomial<FieldValueType>({points[j].first - points[m].first}));
-                        }
-                    }
-                    result = result + term;
+                std::vector<FieldValueType> xs;
+                std::vector<FieldValueType> ys;
+                xs.reserve(std::size(points));
+                ys.reserve(std::size(points));
+                for (const auto &point : points) {
+                    xs.emplace_back(point.first);
+                    ys.emplace_back(point.second);
                 }
-                return result;
+
+                return detail::fast_interpolation<FieldValueType>(xs, ys);
+            }
+
+            /**
+             * Interpolate the polynomial of degree less than k through the points (xs[i], ys[i]), i < k.
+             */
+            template<typename Range1,
+                     typename Range2,
+                     typename FieldValueType =
+                         typename std::iterator_traits<decltype(std::begin(std::declval<const Range1 &>()))>::value_type>
+            typename std::enable_if<
+                std::is_same<FieldValueType,
+                             typename std::iterator_traits<decltype(std::begin(
+                                 std::declval<const Range2 &>()))>::value_type>::value,
+                polynomial<FieldValueType>>::type
+                lagrange_interpolation(const Range1 &xs, const Range2 &ys) {
+
+                return detail::fast_interpolation<FieldValueType>(xs, ys);
             }
         }    // namespace math
     }        // namespace crypto3
@@ -0,0 +1,402 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_MULTILINEAR_POLYNOMIAL_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_MULTILINEAR_POLYNOMIAL_HPP
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/config.hpp>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /*
+                 * Entries of a multilinear table handled by one thread at a time. Every kernel below runs over
+                 * contiguous ranges of the two halves of the table, which the compiler can vectorize.
+                 */
+                constexpr std::size_t multilinear_block_size = 1 << 12;
+
+                /*
+                 * out[i] = lo[i] + r * (hi[i] - lo[i]) for i < half, out may alias lo.
+                 */
+                template<typename ValueType>
+                void multilinear_fold(ValueType *out,
+                                      const ValueType *lo,
+                                      const ValueType *hi,
+                                      std::size_t half,
+                                      const ValueType &r) {
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t start = 0; start < half; start += multilinear_block_size) {
+                        const std::size_t end = std::min(start + multilinear_block_size, half);
+                        for (std::size_t i = start; i < end; ++i) {
+                            out[i] = lo[i] + r * (hi[i] - lo[i]);
+                        }
+                    }
+                }
+
+                /*
+                 * Sum of a[0, n), summed by blocks whose partial sums are then added up.
+                 */
+                template<typename ValueType>
+                ValueType multilinear_sum(const ValueType *a, std::size_t n) {
+                    const std::size_t blocks = (n + multilinear_block_size - 1) / multilinear_block_size;
+                    std::vector<ValueType> partial(blocks, ValueType::zero());
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t j = 0; j < blocks; ++j) {
+                        const std::size_t end = std::min((j + 1) * multilinear_block_size, n);
+                        ValueType s = ValueType::zero();
+                        for (std::size_t i = j * multilinear_block_size; i < end; ++i) {
+                            s += a[i];
+                        }
+                        partial[j] = s;
+                    }
+
+                    ValueType result = ValueType::zero();
+                    for (const ValueType &s : partial) {
+                        result += s;
+                    }
+                    return result;
+                }
+            }    // namespace detail
+
+            /**
+             * Multilinear polynomial in k variables given by its 2^k evaluations over the boolean hypercube.
+             * Entry i is the value at (x_0, ..., x_{k-1}) with x_j the j-th bit of i, so the last variable
+             * splits the table into two contiguous halves: fixing it, as a sumcheck round does, is a single
+             * pass over both halves.
+             */
+            template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>>
+            class multilinear_polynomial {
+                typedef std::vector<FieldValueType, Allocator> container_type;
+
+                container_type val;
+
+            public:
+                typedef typename container_type::value_type value_type;
+                typedef typename container_type::allocator_type allocator_type;
+                typedef typename container_type::reference reference;
+                typedef typename container_type::const_reference const_reference;
+                typedef typename container_type::size_type size_type;
+                typedef typename container_type::iterator iterator;
+                typedef typename container_type::const_iterator const_iterator;
+
+                /**
+                 * The constant zero, a polynomial in no variables.
+                 */
+                multilinear_polynomial() : val(1, FieldValueType::zero()) {
+                }
+
+                /**
+                 * The zero polynomial in k variables.
+                 */
+                explicit multilinear_polynomial(std::size_t k, const allocator_type &a = allocator_type()) :
+                    val(std::size_t(1) << k, FieldValueType::zero(), a) {
+                }
+
+                template<typename InputIterator>
+                multilinear_polynomial(InputIterator first, InputIterator last) : val(first, last) {
+                    check_size();
+                }
+
+                multilinear_polynomial(std::initializer_list<value_type> il) : val(il) {
+                    check_size();
+                }
+
+                explicit multilinear_polynomial(const container_type &c) : val(c) {
+                    check_size();
+                }
+
+                explicit multilinear_polynomial(container_type &&c) : val(std::move(c)) {
+                    check_size();
+                }
+
+                bool operator==(const multilinear_polynomial &rhs) const {
+                    return val == rhs.val;
+                }
+                bool operator!=(const multilinear_polynomial &rhs) const {
+                    return !(rhs == *this);
+                }
+
+                allocator_type get_allocator() const BOOST_NOEXCEPT {
+                    return val.get_allocator();
+                }
+
+                iterator begin() BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+                const_iterator begin() const BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+                iterator end() BOOST_NOEXCEPT {
+                    return val.end();
+                }
+                const_iterator end() const BOOST_NOEXCEPT {
+                    return val.end();
+                }
+
+                reference operator[](size_type n) BOOST_NOEXCEPT {
+                    return val[n];
+                }
+                const_reference operator[](size_type n) const BOOST_NOEXCEPT {
+                    return val[n];
+                }
+                value_type *data() BOOST_NOEXCEPT {
+                    return val.data();
+                }
+                const value_type *data() const BOOST_NOEXCEPT {
+                    return val.data();
+                }
+
+                /**
+                 * Number of entries of the table, 2^num_variables().
+                 */
+                size_type size() const BOOST_NOEXCEPT {
+                    return val.size();
+                }
+
+                std::size_t num_variables() const BOOST_NOEXCEPT {
+                    std::size_t k = 0;
+                    while ((std::size_t(1) << k) < val.size()) {
+                        ++k;
+                    }
+                    return k;
+                }
+
+                void swap(multilinear_polynomial &other) {
+                    val.swap(other.val);
+                }
+
+                /**
+                 * Sum over the boolean hypercube.
+                 */
+                FieldValueType sum() const {
+                    return detail::multilinear_sum(val.data(), val.size());
+                }
+
+                /**
+                 * Value at point = (x_0, ..., x_{k-1}), by fixing the variables one after the other from the last.
+                 */
+                template<typename Range>
+                FieldValueType evaluate(const Range &point) const {
+                    const std::size_t k = num_variables();
+                    if (static_cast<std::size_t>(std::distance(std::begin(point), std::end(point))) != k) {
+                        throw std::invalid_argument("multilinear_polynomial: expected a point of num_variables()");
+                    }
+                    if (k == 0) {
+                        return val[0];
+                    }
+
+                    std::vector<FieldValueType> t(val.size() / 2);
+                    auto x = std::end(point);
+                    --x;
+                    detail::multilinear_fold(t.data(), val.data(), val.data() + t.size(), t.size(),
+                                             FieldValueType(*x));
+                    for (std::size_t half = t.size() / 2; half > 0; half /= 2) {
+                        --x;
+                        detail::multilinear_fold(t.data(), t.data(), t.data() + half, half, FieldValueType(*x));
+                    }
+                    return t[0];
+                }
+
+                /**
+                 * The polynomial in the first k - 1 variables obtained by fixing the last one to r.
+                 */
+                multilinear_polynomial fold(const FieldValueType &r) const {
+                    if (val.size() == 1) {
+                        throw std::invalid_argument("multilinear_polynomial: no variable left to fold");
+                    }
+                    const std::size_t half = val.size() / 2;
+                    multilinear_polynomial result(num_variables() - 1, val.get_allocator());
+                    detail::multilinear_fold(result.data(), val.data(), val.data() + half, half, r);
+                    return result;
+                }
+
+                /**
+                 * Fix the last variable to r in place. The table is halved without reallocating, so a
+                 * sumcheck prover folding every round allocates nothing.
+                 */
+                void fold_in_place(const FieldValueType &r) {
+                    if (val.size() == 1) {
+                        throw std::invalid_argument("multilinear_polynomial: no variable left to fold");
+                    }
+                    const std::size_t half = val.size() / 2;
+                    detail::multilinear_fold(val.data(), val.data(), val.data() + half, half, r);
+                    val.resize(half);
+                }
+
+                multilinear_polynomial &operator+=(const multilinear_polynomial &other) {
+                    check_same_size(other);
+                    std::transform(other.begin(), other.end(), this->begin(), this->begin(),
+                                   std::plus<FieldValueType>());
+                    return *this;
+                }
+
+                multilinear_polynomial &operator-=(const multilinear_polynomial &other) {
+                    check_same_size(other);
+                    std::transform(this->begin(), this->end(), other.begin(), this->begin(),
+                                   std::minus<FieldValueType>());
+                    return *this;
+                }
+
+                multilinear_polynomial &operator*=(const FieldValueType &c) {
+                    for (FieldValueType &u : val) {
+                        u *= c;
+                    }
+                    return *this;
+                }
+
+                multilinear_polynomial operator+(const multilinear_polynomial &other) const {
+                    multilinear_polynomial result(*this);
+                    result += other;
+                    return result;
+                }
+
+                multilinear_polynomial operator-() const {
+                    multilinear_polynomial result(*this);
+                    for (FieldValueType &u : result.val) {
+                        u = -u;
+                    }
+                    return result;
+                }
+
+                multilinear_polynomial operator-(const multilinear_polynomial &other) const {
+                    multilinear_polynomial result(*this);
+                    result -= other;
+                    return result;
+                }
+
+                multilinear_polynomial operator*(const FieldValueType &c) const {
+                    multilinear_polynomial result(*this);
+                    result *= c;
+                    return result;
+                }
+
+            private:
+                void check_size() const {
+                    if (val.empty() || (val.size() & (val.size() - 1)) != 0) {
+                        throw std::invalid_argument("multilinear_polynomial: expected a table of size 2^k");
+                    }
+                }
+
+                void check_same_size(const multilinear_polynomial &other) const {
+                    if (other.size() != this->size()) {
+                        throw std::invalid_argument("multilinear_polynomial: expected the same number of variables");
+                    }
+                }
+            };
+
+            /**
+             * One sumcheck round for the product of the multilinear polynomials in factors: the values at
+             * t = 0, ..., d of the degree d = factors.size() univariate
+             *     g(t) = sum over the hypercube of the first k - 1 variables of prod_j f_j(x, t),
+             * from a single pass over the halves of every table, block partial sums spread over threads when
+             * built with MULTICORE. A prover then folds every factor with the verifier's challenge.
+             */
+            template<typename Range,
+                     typename PolynomialType =
+                         typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type>
+            std::vector<typename PolynomialType::value_type> sumcheck_round(const Range &factors) {
+                typedef PolynomialType polynomial_type;
+                typedef typename polynomial_type::value_type value_type;
+
+                std::vector<const value_type *> tables;
+                for (const polynomial_type &f : factors) {
+                    tables.push_back(f.data());
+                }
+                if (tables.empty()) {
+                    throw std::invalid_argument("sumcheck_round: expected at least one factor");
+                }
+                const std::size_t size = std::begin(factors)->size();
+                for (const polynomial_type &f : factors) {
+                    if (f.size() != size) {
+                        throw std::invalid_argument("sumcheck_round: expected the same number of variables");
+                    }
+                }
+                if (size == 1) {
+                    throw std::invalid_argument("sumcheck_round: no variable left to sum over");
+                }
+
+                const std::size_t d = tables.size();
+                const std::size_t half = size / 2;
+                const std::size_t blocks = (half + detail::multilinear_block_size - 1) / detail::multilinear_block_size;
+                std::vector<std::vector<value_type>> partial(blocks);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                for (std::size_t b = 0; b < blocks; ++b) {
+                    const std::size_t end = std::min((b + 1) * detail::multilinear_block_size, half);
+                    std::vector<value_type> acc(d + 1, value_type::zero());
+                    std::vector<value_type> v(d), step(d);
+                    for (std::size_t i = b * detail::multilinear_block_size; i < end; ++i) {
+                        for (std::size_t j = 0; j < d; ++j) {
+                            v[j] = tables[j][i];
+                            step[j] = tables[j][i + half] - v[j];
+                        }
+                        /* f_j(x, t) = lo + t * (hi - lo), stepped from t = 0 to d */
+                        for (std::size_t t = 0; t <= d; ++t) {
+                            value_type product = v[0];
+                            for (std::size_t j = 1; j < d; ++j) {
+                                product *= v[j];
+                            }
+                            acc[t] += product;
+                            if (t < d) {
+                                for (std::size_t j = 0; j < d; ++j) {
+                                    v[j] += step[j];
+                                }
+                            }
+                        }
+                    }
+                    partial[b] = std::move(acc);
+                }
+
+                std::vector<value_type> result(d + 1, value_type::zero());
+                for (const std::vector<value_type> &acc : partial) {
+                    for (std::size_t t = 0; t <= d; ++t) {
+                        result[t] += acc[t];
+                    }
+                }
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_MULTILINEAR_POLYNOMIAL_HPP
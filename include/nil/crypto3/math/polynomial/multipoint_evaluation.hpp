@@ -0,0 +1,297 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_MULTIPOINT_EVALUATION_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_MULTIPOINT_EVALUATION_HPP
+
+#include <algorithm>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/evaluate.hpp>
+#include <nil/crypto3/math/polynomial/subproduct_tree.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * A set of points x_0, ..., x_{n-1} prepared for fast multipoint evaluation.
+             *
+             * The subproduct tree of the points and the inverses of the reversed tree nodes are computed once,
+             * so every evaluation only walks down the remainder tree in O(M(n) log n). Below we make use of the
+             * remainder tree from [Gathen and Gerhard, Modern Computer Algebra 3rd Ed., Section 10.1] and the
+             * fast division from Section 9.1.
+             */
+            template<typename FieldType>
+            class point_set {
+                typedef typename FieldType::value_type value_type;
+
+            public:
+                typedef FieldType field_type;
+
+                /*
+                 * Remainders by nodes of degree at most schoolbook_threshold are computed by long division, and
+                 * once the nodes get that small the remaining points are evaluated by Horner's rule.
+                 */
+                constexpr static const std::size_t schoolbook_threshold = 32;
+
+                point_set() : cutoff(0) {
+                }
+
+                template<typename Range>
+                explicit point_set(const Range &points) {
+                    build(points);
+                }
+
+                template<typename Range>
+                void build(const Range &points) {
+                    T.build(points);
+
+                    cutoff = 0;
+                    while (cutoff < T.depth() && (std::size_t(2) << cutoff) <= schoolbook_threshold) {
+                        ++cutoff;
+                    }
+
+                    /*
+                     * Node (i, j) is a divisor for the remainders of its parent, whose quotient is shorter than
+                     * 2^i, so its inverse is stored with precision 2^i at offset inverse_offset[i] + 2^i * j.
+                     */
+                    inverse_offset.assign(T.depth() + 1, 0);
+                    for (std::size_t i = 0; i < T.depth(); i++) {
+                        inverse_offset[i + 1] = inverse_offset[i] + (T.nodes(i) << i);
+                    }
+                    inverses.assign(inverse_offset[T.depth()], value_type::zero());
+
+                    for (std::size_t i = cutoff + 1; i < T.depth(); i++) {
+                        const std::size_t count = T.nodes(i);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                        for (std::size_t j = 0; j < count; j++) {
+                            std::vector<value_type> rev = reversed_node(i, j);
+                            rev = power_series_inverse(rev, std::size_t(1) << i);
+                            std::copy(rev.begin(), rev.end(), inverses.begin() + inverse_offset[i] + (j << i));
+                        }
+                    }
+                }
+
+                std::size_t size() const {
+                    return T.size();
+                }
+
+                const subproduct_tree<FieldType> &tree() const {
+                    return T;
+                }
+
+                /**
+                 * Evaluate the polynomial with coefficients f at all the points.
+                 */
+                template<typename Range>
+                std::vector<value_type> evaluate(const Range &f) const {
+                    const std::size_t n = T.size();
+
+                    std::vector<value_type> result(n, value_type::zero());
+                    if (n == 0) {
+                        return result;
+                    }
+
+                    std::vector<value_type> current(n, value_type::zero());
+                    std::vector<value_type> next(n, value_type::zero());
+
+                    /* Reduce modulo the vanishing polynomial of all points */
+                    std::vector<value_type> a(std::begin(f), std::end(f));
+                    reduce_by_root(a, current.data());
+
+                    /* Remainder tree: the remainder of a child is the parent's remainder modulo the child */
+                    std::size_t level = T.depth();
+                    while (level > cutoff) {
+                        --level;
+                        const std::size_t count = T.nodes(level);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                        for (std::size_t j = 0; j < count; j++) {
+                            const std::size_t parent = j >> 1;
+                            reduce(current.data() + (parent << (level + 1)),
+                                   T.node_degree(level + 1, parent),
+                                   level,
+                                   j,
+                                   next.data() + (j << level));
+                        }
+
+                        current.swap(next);
+                    }
+
+                    const std::size_t count = T.nodes(level);
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t j = 0; j < count; j++) {
+                        const value_type *r = current.data() + (j << level);
+                        const std::size_t d = T.node_degree(level, j);
+
+                        for (std::size_t k = (j << level); k < (j << level) + d; k++) {
+                            const value_type x = T.point(k);
+
+                            value_type y = value_type::zero();
+                            for (std::size_t u = d; u > 0; u--) {
+                                y = y * x + r[u - 1];
+                            }
+                            result[k] = y;
+                        }
+                    }
+
+                    return result;
+                }
+
+            private:
+                /*
+                 * rev(T_{i, j}) = x^d * T_{i, j}(1 / x), truncated to the precision of the stored inverse.
+                 */
+                std::vector<value_type> reversed_node(std::size_t i, std::size_t j) const {
+                    const std::size_t d = T.node_degree(i, j);
+                    const value_type *t = T.node_data(i, j);
+
+                    std::vector<value_type> rev(std::min(d + 1, std::size_t(1) << i), value_type::zero());
+                    rev[0] = value_type::one();
+                    for (std::size_t u = 1; u < rev.size(); u++) {
+                        rev[u] = t[d - u];
+                    }
+                    return rev;
+                }
+
+                /*
+                 * Write the d low coefficients of (a mod t) to out, where t = x^d + t_{d-1} x^{d-1} + ... + t_0.
+                 * With k = len - d the quotient is q = rev(rev(a) * rev(t)^{-1} mod x^k), and only the low d
+                 * coefficients of q * t are needed for the remainder.
+                 */
+                static void divide(const value_type *a,
+                                   std::size_t len,
+                                   const value_type *t,
+                                   std::size_t d,
+                                   const value_type *inverse,
+                                   value_type *out) {
+                    if (len <= d) {
+                        std::copy(a, a + len, out);
+                        std::fill(out + len, out + d, value_type::zero());
+                        return;
+                    }
+
+                    const std::size_t k = len - d;
+
+                    if (inverse == nullptr || k <= schoolbook_threshold || d <= schoolbook_threshold) {
+                        std::vector<value_type> r(a, a + len);
+                        for (std::size_t s = len - 1; s >= d; s--) {
+                            const value_type c = r[s];
+                            for (std::size_t u = 0; u < d; u++) {
+                                r[s - d + u] -= c * t[u];
+                            }
+                        }
+                        std::copy(r.begin(), r.begin() + d, out);
+                        return;
+                    }
+
+                    std::vector<value_type> q(k);
+                    for (std::size_t u = 0; u < k; u++) {
+                        q[u] = a[len - 1 - u];
+                    }
+                    multiplication(q, q, std::vector<value_type>(inverse, inverse + k));
+                    q.resize(k, value_type::zero());
+                    std::reverse(q.begin(), q.end());
+
+                    multiplication(q, q, std::vector<value_type>(t, t + d));
+                    q.resize(d, value_type::zero());
+
+                    for (std::size_t u = 0; u < d; u++) {
+                        out[u] = a[u] - q[u];
+                    }
+                }
+
+                void reduce(const value_type *a, std::size_t len, std::size_t i, std::size_t j, value_type *out) const {
+                    const value_type *inverse = (std::size_t(1) << i) > schoolbook_threshold ?
+                                                    inverses.data() + inverse_offset[i] + (j << i) :
+                                                    nullptr;
+                    divide(a, len, T.node_data(i, j), T.node_degree(i, j), inverse, out);
+                }
+
+                void reduce_by_root(const std::vector<value_type> &a, value_type *out) const {
+                    const std::size_t n = T.size();
+                    const std::size_t h = T.depth();
+
+                    if (a.size() <= n + schoolbook_threshold || n <= schoolbook_threshold) {
+                        divide(a.data(), a.size(), T.node_data(h, 0), n, nullptr, out);
+                        return;
+                    }
+
+                    const std::size_t k = a.size() - n;
+                    std::vector<value_type> rev(std::min(n + 1, k), value_type::zero());
+                    rev[0] = value_type::one();
+                    for (std::size_t u = 1; u < rev.size(); u++) {
+                        rev[u] = T.node_data(h, 0)[n - u];
+                    }
+                    rev = power_series_inverse(rev, k);
+
+                    divide(a.data(), a.size(), T.node_data(h, 0), n, rev.data(), out);
+                }
+
+                subproduct_tree<FieldType> T;
+                std::size_t cutoff;
+                std::vector<std::size_t> inverse_offset;
+                std::vector<value_type> inverses;
+            };
+
+            namespace detail {
+                /*
+                 * Up to this many points the tiled Horner evaluation beats building the subproduct tree.
+                 */
+                constexpr std::size_t multipoint_horner_threshold = 512;
+            }    // namespace detail
+
+            /**
+             * Evaluate the polynomial with coefficients f at every point in O(M(n) log n), where n is the number of
+             * points. Few points are evaluated directly by evaluate_at_points. Use point_set directly to evaluate
+             * several polynomials at the same points.
+             */
+            template<typename FieldType, typename Range1, typename Range2>
+            std::vector<typename FieldType::value_type> multipoint_evaluation(const Range1 &f, const Range2 &points) {
+                if (std::size_t(std::distance(std::begin(points), std::end(points))) <=
+                    detail::multipoint_horner_threshold) {
+                    return evaluate_at_points(f, points);
+                }
+                return point_set<FieldType>(points).evaluate(f);
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_MULTIPOINT_EVALUATION_HPP
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/evaluate.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -89,10 +90,10 @@ namespace nil {
 
                 polynomial(polynomial&& x) BOOST_NOEXCEPT
                     (std::is_nothrow_move_constructible<allocator_type>::value) :
-                    val(x.val) {
+                    val(std::move(x.val)) {
                 }
 
-                polynomial(polynomial&& x, const allocator_type& a) : val(x.val, a) {
+                polynomial(polynomial&& x, const allocator_type& a) : val(std::move(x.val), a) {
                 }
 
                 polynomial(const FieldValueType& value, std::size_t power = 0) : val(power + 1, FieldValueType(0)) {
@@ -103,7 +104,7 @@ namespace nil {
 
                 }
 
-                explicit polynomial(container_type &&c) : val(c) {
+                explicit polynomial(container_type &&c) : val(std::move(c)) {
 
                 }
 
@@ -113,7 +114,7 @@ namespace nil {
                 }
 
                 polynomial& operator=(polynomial&& x) {
-                    val = x.val;
+                    val = std::move(x.val);
                     return *this;
                 }
 
@@ -123,7 +124,7 @@ namespace nil {
                 }
 
                 polynomial& operator=(container_type&& x) {
-                    val = x;
+                    val = std::move(x);
                     return *this;
                 }
 
@@ -154,7 +155,7 @@ namespace nil {
                 }
 
                 allocator_type get_allocator() const BOOST_NOEXCEPT {
-                    return this->val.__alloc();
+                    return this->val.get_allocator();
                 }
 
                 iterator begin() BOOST_NOEXCEPT {
@@ -266,7 +267,7 @@ namespace nil {
                 }
 
                 void push_back(value_type&& _x) {
-                    val.push_back(_x);
+                    val.push_back(std::move(_x));
                 }
 
                 template<class... Args>
@@ -341,12 +342,7 @@ namespace nil {
                 }
 
                 FieldValueType evaluate(const FieldValueType& value) const {
-                    FieldValueType result = 0;
-                    auto end = this->end();
-                    while (end != this->begin()) {
-                        result = result * value + *--end;
-                    }
-                    return result;
+                    return evaluate_at(*this, value);
                 }
 
                 /**
@@ -380,37 +376,54 @@ namespace nil {
                     this->resize(n);
                 }
 
+                /**
+                 * Computes the standard polynomial addition, polynomial A + polynomial B, and stores result in
+                 * polynomial A.
+                 */
+                polynomial& operator+=(const polynomial& other) {
+                    if (other.size() > this->size()) {
+                        this->resize(other.size(), FieldValueType::zero());
+                    }
+                    std::transform(other.begin(), other.end(), this->begin(), this->begin(),
+                                   std::plus<FieldValueType>());
+                    this->condense();
+                    return *this;
+                }
+
+                /**
+                 * Computes the standard polynomial subtraction, polynomial A - polynomial B, and stores result in
+                 * polynomial A.
+                 */
+                polynomial& operator-=(const polynomial& other) {
+                    if (other.size() > this->size()) {
+                        this->resize(other.size(), FieldValueType::zero());
+                    }
+                    std::transform(this->begin(), this->begin() + other.size(), other.begin(), this->begin(),
+                                   std::minus<FieldValueType>());
+                    this->condense();
+                    return *this;
+                }
+
+                /**
+                 * Perform the multiplication of two polynomials, polynomial A * polynomial B, and stores result in
+                 * polynomial A.
+                 */
+                polynomial& operator*=(const polynomial& other) {
+                    multiplication(*this, *this, other);
+                    return *this;
+                }
+
                 /**
                  * Computes the standard polynomial addition, polynomial A + polynomial B, and stores result in
                  * polynomial C.
                  */
                 polynomial operator+(const polynomial& other) const {
-                    if (this->is_zero()) {
-                        return other;
-                    } else if (other.is_zero()) {
-                        return *this;
-                    } else {
-                        polynomial result;
-
-                        std::size_t a_size = std::distance(this->begin(), this->end());
-                        std::size_t b_size = std::distance(other.begin(), other.end());
-
-                        if (a_size > b_size) {
-                            result.resize(a_size);
-                            std::transform(other.begin(), other.end(), this->begin(), result.begin(),
-                                           std::plus<FieldValueType>());
-                            std::copy(this->begin() + b_size, this->end(), result.begin() + b_size);
-                        } else {
-                            result.resize(b_size);
-                            std::transform(this->begin(), this->end(), other.begin(), result.begin(),
-                                           std::plus<FieldValueType>());
-                            std::copy(other.begin() + a_size, other.end(), result.begin() + a_size);
-                        }
-
-                        result.condense();
-
-                        return result;
-                    }
+                    container_type c;
+                    c.reserve(std::max(this->size(), other.size()));
+                    c.assign(this->begin(), this->end());
+                    polynomial result(std::move(c));
+                    result += other;
+                    return result;
                 }
 
                 polynomial operator-() const {
@@ -426,33 +439,12 @@ namespace nil {
                  * polynomial C.
                  */
                 polynomial operator-(const polynomial& other) const {
-                    if (this->is_zero()) {
-                        return -(other);
-                    } else if (other.is_zero()) {
-                        return *this;
-                    } else {
-                        polynomial result;
-
-                        std::size_t a_size = std::distance(this->begin(), this->end());
-                        std::size_t b_size = std::distance(other.begin(), other.end());
-
-                        if (a_size > b_size) {
-                            result.resize(a_size);
-                            std::transform(this->begin(), this->begin() + b_size, other.begin(), result.begin(),
-                                           std::minus<FieldValueType>());
-                            std::copy(this->begin() + b_size, this->end(), result.begin() + b_size);
-                        } else {
-                            result.resize(b_size);
-                            std::transform(this->begin(), this->end(), other.begin(), result.begin(),
-                                           std::minus<FieldValueType>());
-                            std::transform(other.begin() + a_size, other.end(), result.begin() + a_size,
-                                           std::negate<FieldValueType>());
-                        }
-
-                        result.condense();
-
-                        return result;
-                    }
+                    container_type c;
+                    c.reserve(std::max(this->size(), other.size()));
+                    c.assign(this->begin(), this->end());
+                    polynomial result(std::move(c));
+                    result -= other;
+                    return result;
                 }
 
                 /**
@@ -460,90 +452,71 @@ namespace nil {
                  * polynomial C.
                  */
                 polynomial operator*(const polynomial& other) const {
-                    polynomial result;
-                    fft_multiplication(result, *this, other);
+                    polynomial result((container_type()));
+                    multiplication(result, *this, other);
                     return result;
                 }
 
                 /**
-                 * Perform the standard Euclidean Division algorithm.
+                 * Perform the Euclidean Division algorithm, see math::division.
                  * Input: Polynomial A, Polynomial B, where A / B
                  * Output: Polynomial Q, such that A = (Q * B) + R.
                  */
                 polynomial operator/(const polynomial& other) const {
-
-                    std::size_t d = other.size() - 1;           /* Degree of B */
-                    FieldValueType c = other.back().inversed(); /* Inverse of Leading Coefficient of B */
-
-                    polynomial r(*this);
-                    polynomial q = polynomial(r.size(), FieldValueType::zero());
-
-                    std::size_t r_deg = r.size() - 1;
-                    std::size_t shift;
-
-                    while (r_deg >= d && !r.is_zero()) {
-                        if (r_deg >= d) {
-                            shift = r_deg - d;
-                        } else {
-                            shift = 0;
-                        }
-
-                        FieldValueType lead_coeff = r.back() * c;
-
-                        q[shift] += lead_coeff;
-
-                        if (other.size() + shift + 1 > r.size()) {
-                            r.resize(other.size() + shift + 1);
-                        }
-                        auto glambda = [=](const FieldValueType& x, const FieldValueType& y) {
-                            return y - (x * lead_coeff);
-                        };
-                        std::transform(other.begin(), other.end(), r.begin() + shift, r.begin() + shift, glambda);
-                        r.condense();
-
-                        r_deg = r.size() - 1;
-                    }
-                    q.condense();
-
+                    polynomial q((container_type())), r((container_type()));
+                    division(q, r, *this, other);
                     return q;
                 }
 
                 /**
-                 * Perform the standard Euclidean Division algorithm.
+                 * Perform the Euclidean Division algorithm, see math::division.
                  * Input: Polynomial A, Polynomial B, where A / B
                  * Output: Polynomial R, such that A = (Q * B) + R.
                  */
                 polynomial operator%(const polynomial& other) const {
-                    std::size_t d = other.size() - 1;           /* Degree of B */
-                    FieldValueType c = other.back().inversed(); /* Inverse of Leading Coefficient of B */
-
-                    polynomial r(*this);
-
-                    std::size_t r_deg = r.size() - 1;
-                    std::size_t shift;
+                    polynomial q((container_type())), r((container_type()));
+                    division(q, r, *this, other);
+                    return r;
+                }
+            };
 
-                    while (r_deg >= d && !r.is_zero()) {
-                        if (r_deg >= d) {
-                            shift = r_deg - d;
-                        } else {
-                            shift = 0;
-                        }
+            /*
+             * Sums with an rvalue operand reuse its buffer.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator+(polynomial<FieldValueType, Allocator>&& A,
+                                                            const polynomial<FieldValueType, Allocator>& B) {
+                A += B;
+                return std::move(A);
+            }
 
-                        FieldValueType lead_coeff = r.back() * c;
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator+(const polynomial<FieldValueType, Allocator>& A,
+                                                            polynomial<FieldValueType, Allocator>&& B) {
+                B += A;
+                return std::move(B);
+            }
 
-                        if (other.size() + shift + 1 > r.size()) {
-                            r.resize(other.size() + shift + 1);
-                        }
-                        auto glambda = [=](FieldValueType x, FieldValueType y) { return y - (x * lead_coeff); };
-                        std::transform(other.begin(), other.end(), r.begin() + shift, r.begin() + shift, glambda);
-                        r.condense();
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator+(polynomial<FieldValueType, Allocator>&& A,
+                                                            polynomial<FieldValueType, Allocator>&& B) {
+                A += B;
+                return std::move(A);
+            }
 
-                        r_deg = r.size() - 1;
-                    }
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator-(polynomial<FieldValueType, Allocator>&& A,
+                                                            const polynomial<FieldValueType, Allocator>& B) {
+                A -= B;
+                return std::move(A);
+            }
 
-                    return r;
-                }
-            };
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator-(polynomial<FieldValueType, Allocator>&& A,
+                                                            polynomial<FieldValueType, Allocator>&& B) {
+                A -= B;
+                return std::move(A);
+            }
 
             template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>,
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
@@ -28,14 +28,25 @@
 #define CRYPTO3_MATH_POLYNOMIAL_POLYNOM_DFT_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/evaluate.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
-            // Optimal val.size must be power of two, if it's not true we have points that we will never use
+            /**
+             * Polynomial given by its evaluations over a radix-2 domain. The val.size must be a power of two,
+             * otherwise some evaluation points are never used.
+             *
+             * By default it behaves like a plain container: every const member needing the coefficient form
+             * runs an inverse transform of the current evaluations. Callers reading the coefficients of an
+             * unchanged polynomial several times may keep them with cache_coefficients(); from then on the
+             * object trusts that the evaluations only change through write access obtained after that call.
+             */
             template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>>
             class polynomial_dfs {
                 typedef std::vector<FieldValueType, Allocator> container_type;
@@ -43,6 +54,17 @@ namespace nil {
                 container_type val;
                 size_t _d;
 
+                /*
+                 * Coefficient form of the polynomial, trimmed of high zero coefficients. Only filled by
+                 * cache_coefficients() and by quotients and remainders, and carried over by the copy and move
+                 * constructors; it is immutable once published, so const members may read it from several
+                 * threads. It is only trusted while _coefficients_valid is set: every member giving write access
+                 * to the evaluations clears the flag and leaves the pointer alone, so writers running in parallel
+                 * only touch an atomic.
+                 */
+                mutable std::shared_ptr<const std::vector<FieldValueType>> _coefficients;
+                mutable std::atomic<bool> _coefficients_valid {false};
+
             public:
                 typedef typename container_type::value_type value_type;
                 typedef typename container_type::allocator_type allocator_type;
@@ -93,10 +115,14 @@ namespace nil {
 
                 ~polynomial_dfs() = default;
 
-                polynomial_dfs(const polynomial_dfs& x) : val(x.val), _d(x._d) {
+                polynomial_dfs(const polynomial_dfs& x) :
+                    val(x.val), _d(x._d), _coefficients(x.valid_coefficients()),
+                    _coefficients_valid(bool(_coefficients)) {
                 }
 
-                polynomial_dfs(const polynomial_dfs& x, const allocator_type& a) : val(x.val, a), _d(x._d) {
+                polynomial_dfs(const polynomial_dfs& x, const allocator_type& a) :
+                    val(x.val, a), _d(x._d), _coefficients(x.valid_coefficients()),
+                    _coefficients_valid(bool(_coefficients)) {
                 }
 
                 polynomial_dfs(size_t d, std::initializer_list<value_type> il) : val(il), _d(d) {
@@ -111,11 +137,15 @@ namespace nil {
 
                 polynomial_dfs(polynomial_dfs&& x)
                     BOOST_NOEXCEPT(std::is_nothrow_move_constructible<allocator_type>::value) :
-                    val(x.val),
-                    _d(x._d) {
+                    val(std::move(x.val)),
+                    _d(x._d), _coefficients(x.valid_coefficients()), _coefficients_valid(bool(_coefficients)) {
+                    x.drop_coefficients();
                 }
 
-                polynomial_dfs(polynomial_dfs&& x, const allocator_type& a) : val(x.val, a), _d(x._d) {
+                polynomial_dfs(polynomial_dfs&& x, const allocator_type& a) :
+                    val(std::move(x.val), a), _d(x._d), _coefficients(x.valid_coefficients()),
+                    _coefficients_valid(bool(_coefficients)) {
+                    x.drop_coefficients();
                 }
 
                 //                polynomial_dfs(const FieldValueType& value, std::size_t power = 0) : val(power + 1,
@@ -128,7 +158,7 @@ namespace nil {
                                      "DFS optimal polynom size must be power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynom size must be power of two");
                 }
@@ -136,12 +166,15 @@ namespace nil {
                 polynomial_dfs& operator=(const polynomial_dfs& x) {
                     val = x.val;
                     _d = x._d;
+                    drop_coefficients();
                     return *this;
                 }
 
                 polynomial_dfs& operator=(polynomial_dfs&& x) {
-                    val = x.val;
+                    val = std::move(x.val);
                     _d = x._d;
+                    drop_coefficients();
+                    x.drop_coefficients();
                     return *this;
                 }
 
@@ -161,10 +194,10 @@ namespace nil {
                 //                }
 
                 bool operator==(const polynomial_dfs& rhs) const {
-                    return val == rhs.val && _d == rhs.d;
+                    return val == rhs.val && _d == rhs._d;
                 }
                 bool operator!=(const polynomial_dfs& rhs) const {
-                    return !(rhs == *this && _d == rhs.d);
+                    return !(*this == rhs);
                 }
 
                 //                template<typename InputIterator>
@@ -182,10 +215,11 @@ namespace nil {
                 //                }
 
                 allocator_type get_allocator() const BOOST_NOEXCEPT {
-                    return this->val.__alloc();
+                    return this->val.get_allocator();
                 }
 
                 iterator begin() BOOST_NOEXCEPT {
+                    invalidate();
                     return val.begin();
                 }
 
@@ -193,6 +227,7 @@ namespace nil {
                     return val.begin();
                 }
                 iterator end() BOOST_NOEXCEPT {
+                    invalidate();
                     return val.end();
                 }
                 const_iterator end() const BOOST_NOEXCEPT {
@@ -200,6 +235,7 @@ namespace nil {
                 }
 
                 reverse_iterator rbegin() BOOST_NOEXCEPT {
+                    invalidate();
                     return val.rbegin();
                 }
 
@@ -260,12 +296,14 @@ namespace nil {
                 }
 
                 reference operator[](size_type _n) BOOST_NOEXCEPT {
+                    invalidate();
                     return val[_n];
                 }
                 const_reference operator[](size_type _n) const BOOST_NOEXCEPT {
                     return val[_n];
                 }
                 reference at(size_type _n) {
+                    invalidate();
                     return val.at(_n);
                 }
                 const_reference at(size_type _n) const {
@@ -273,12 +311,14 @@ namespace nil {
                 }
 
                 reference front() BOOST_NOEXCEPT {
+                    invalidate();
                     return val.front();
                 }
                 const_reference front() const BOOST_NOEXCEPT {
                     return val.front();
                 }
                 reference back() BOOST_NOEXCEPT {
+                    invalidate();
                     return val.back();
                 }
                 const_reference back() const BOOST_NOEXCEPT {
@@ -286,6 +326,7 @@ namespace nil {
                 }
 
                 value_type* data() BOOST_NOEXCEPT {
+                    invalidate();
                     return val.data();
                 }
 
@@ -294,40 +335,49 @@ namespace nil {
                 }
 
                 void push_back(const_reference _x) {
+                    invalidate();
                     val.push_back(_x);
                 }
 
                 void push_back(value_type&& _x) {
-                    val.push_back(_x);
+                    invalidate();
+                    val.push_back(std::move(_x));
                 }
 
                 template<class... Args>
                 reference emplace_back(Args&&... _args) {
+                    invalidate();
                     return val.template emplace_back(_args...);
                 }
 
                 void pop_back() {
+                    invalidate();
                     val.pop_back();
                 }
 
                 iterator insert(const_iterator _position, const_reference _x) {
+                    invalidate();
                     return val.insert(_position, _x);
                 }
 
                 iterator insert(const_iterator _position, value_type&& _x) {
+                    invalidate();
                     return val.insert(_position, _x);
                 }
                 template<class... Args>
                 iterator emplace(const_iterator _position, Args&&... _args) {
+                    invalidate();
                     return val.template emplace(_position, _args...);
                 }
 
                 iterator insert(const_iterator _position, size_type _n, const_reference _x) {
+                    invalidate();
                     return val.insert(_position, _n, _x);
                 }
 
                 template<class InputIterator>
                 iterator insert(const_iterator _position, InputIterator _first, InputIterator _last) {
+                    invalidate();
                     return val.insert(_position, _first, _last);
                 }
 
@@ -336,35 +386,43 @@ namespace nil {
                 }
 
                 iterator erase(const_iterator _position) {
+                    invalidate();
                     return val.erase(_position);
                 }
 
                 iterator erase(const_iterator _first, const_iterator _last) {
+                    invalidate();
                     return val.erase(_first, _last);
                 }
 
                 void clear() BOOST_NOEXCEPT {
+                    invalidate();
                     val.clear();
                 }
 
+                /**
+                 * Re-evaluates the polynomial over the domain of size _sz from its coefficients. With
+                 * cache_coefficients() called before, resizing only costs the forward transform.
+                 */
                 void resize(size_type _sz) {
                     BOOST_ASSERT_MSG(_sz >= _d, "Can't restore polynomial in the future");
                     typedef typename value_type::field_type FieldType;
 
-                    value_type omega = unity_root<FieldType>(this->size());
-#ifdef MULTICORE
-                    detail::basic_parallel_radix2_fft<FieldType>(val, omega.inversed());
-#else
-                    detail::basic_serial_radix2_fft<FieldType>(val, omega.inversed());
-#endif
-                    const value_type sconst = value_type(this->size()).inversed();
-                    std::transform(val.begin(),
-                                   val.end(),
-                                   val.begin(),
-                                   std::bind(std::multiplies<value_type>(), sconst, std::placeholders::_1));
+                    if (_sz == this->size()) {
+                        return;
+                    }
+                    const std::shared_ptr<const std::vector<FieldValueType>> c = valid_coefficients();
+                    if (c) {
+                        val.assign(c->begin(), c->begin() + std::min(c->size(), _sz));
+                        if (c->size() > _sz) {
+                            invalidate();
+                        }
+                    } else if (!val.empty()) {
+                        inverse_transform(val);
+                    }
+                    val.resize(_sz, FieldValueType::zero());
 
                     value_type omega_new = unity_root<FieldType>(_sz);
-                    val.resize(_sz);
 #ifdef MULTICORE
                     detail::basic_parallel_radix2_fft<FieldType>(val, omega_new);
 #else
@@ -380,39 +438,25 @@ namespace nil {
                 void swap(polynomial_dfs& other) {
                     val.swap(other.val);
                     std::swap(_d, other._d);
+                    _coefficients.swap(other._coefficients);
+                    const bool valid = _coefficients_valid.load(std::memory_order_relaxed);
+                    _coefficients_valid.store(other._coefficients_valid.load(std::memory_order_relaxed),
+                                              std::memory_order_relaxed);
+                    other._coefficients_valid.store(valid, std::memory_order_relaxed);
                 }
 
-                //                std::vector<FieldValueType> evaluate(const std::vector<FieldValueType>& value) const {
-                //                    typedef typename value_type::field_type FieldType;
-                //                    const std::size_t n = detail::power_of_two(this->_d);
-                //
-                //                    std::vector<FieldValueType> c(this->begin(), this->begin() + n);
-                //#ifdef MULTICORE
-                //                    detail::basic_parallel_radix2_fft<FieldType>(c, omega.inversed());
-                //#else
-                //                    detail::basic_serial_radix2_fft<FieldType>(c, (this->_omega).inversed());
-                //#endif
-                //                    std::vector<FieldValueType> result(value.size(), 0);
-                //                    auto end = c.end();
-                //                    while (end != c.begin()) {
-                //                        for (size_t i = 0; i < value.size(); ++i) {
-                //                            result[i] = result[i] * value[i] + *--end;
-                //                        }
-                //                    }
-                //                    return result;
-                //                }
+                /**
+                 * Evaluates the polynomial at every point of values from its coefficients, see evaluate_at_points.
+                 */
+                std::vector<FieldValueType> evaluate(const std::vector<FieldValueType>& values) const {
+                    return evaluate_at_points(*this->coefficients_ptr(), values);
+                }
 
+                /**
+                 * Evaluates the polynomial at value straight from its evaluations, see barycentric_evaluate_at.
+                 */
                 FieldValueType evaluate(const FieldValueType& value) const {
-
-                    typedef typename value_type::field_type FieldType;
-
-                    std::vector<FieldValueType> tmp = this->coefficients();
-                    FieldValueType result = 0;
-                    auto end = tmp.end();
-                    while (end != tmp.begin()) {
-                        result = result * value + *--end;
-                    }
-                    return result;
+                    return barycentric_evaluate_at(*this, value);
                 }
 
                 /**
@@ -434,218 +478,391 @@ namespace nil {
 
                 /**
                  * Computes the standard polynomial addition, polynomial A + polynomial B, and stores result in
-                 * polynomial C.
+                 * polynomial A.
                  */
-                polynomial_dfs operator+(const polynomial_dfs& other) const {
-                    polynomial_dfs result(std::max(this->_d, other._d), this->begin(), this->end());
+                polynomial_dfs& operator+=(const polynomial_dfs& other) {
+                    _d = std::max(_d, other._d);
                     if (other.size() > this->size()) {
-                        result.resize(other.size());
+                        this->resize(other.size());
                     }
                     if (this->size() > other.size()) {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
-                        std::transform(tmp.begin(), tmp.end(), result.begin(), result.begin(),
+                        std::transform(tmp.begin(), tmp.end(), this->begin(), this->begin(),
                                        std::plus<FieldValueType>());
-                        return result;
+                        return *this;
                     }
-                    std::transform(other.begin(), other.end(), result.begin(), result.begin(),
+                    std::transform(other.begin(), other.end(), this->begin(), this->begin(),
                                    std::plus<FieldValueType>());
-                    return result;
-                }
-
-                polynomial_dfs operator-() const {
-                    polynomial_dfs result(this->_d, this->begin(), this->end());
-                    std::transform(this->begin(), this->end(), result.begin(), std::negate<FieldValueType>());
-                    return result;
+                    return *this;
                 }
 
                 /**
                  * Computes the standard polynomial subtraction, polynomial A - polynomial B, and stores result in
-                 * polynomial C.
+                 * polynomial A.
                  */
-                polynomial_dfs operator-(const polynomial_dfs& other) const {
-                    polynomial_dfs result(std::max(_d, other._d), this->begin(), this->end());
+                polynomial_dfs& operator-=(const polynomial_dfs& other) {
+                    _d = std::max(_d, other._d);
                     if (other.size() > this->size()) {
-                        result.resize(other.size());
+                        this->resize(other.size());
                     }
                     if (this->size() > other.size()) {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
-                        std::transform(result.begin(), result.end(), tmp.begin(), result.begin(),
+                        std::transform(this->begin(), this->end(), tmp.begin(), this->begin(),
                                        std::minus<FieldValueType>());
-                        return result;
+                        return *this;
                     }
-                    std::transform(result.begin(), result.end(), other.begin(), result.begin(),
+                    std::transform(this->begin(), this->end(), other.begin(), this->begin(),
                                    std::minus<FieldValueType>());
-                    return result;
+                    return *this;
                 }
 
                 /**
                  * Perform the multiplication of two polynomials, polynomial A * polynomial B, and stores result in
-                 * polynomial C.
+                 * polynomial A.
                  */
-                polynomial_dfs operator*(const polynomial_dfs& other) const {
-                    polynomial_dfs result(this->_d + other._d, this->begin(), this->end());
+                polynomial_dfs& operator*=(const polynomial_dfs& other) {
                     size_t polynomial_s =
                         detail::power_of_two(std::max({this->size(), other.size(), this->_d + other._d + 1}));
-                    if (result.size() < polynomial_s) {
-                        result.resize(polynomial_s);
+                    if (this->size() < polynomial_s) {
+                        this->resize(polynomial_s);
                     }
+                    _d += other._d;
                     if (other.size() < polynomial_s) {
                         polynomial_dfs tmp(other);
                         tmp.resize(polynomial_s);
-                        std::transform(result.begin(), result.end(), tmp.begin(), result.begin(),
+                        std::transform(this->begin(), this->end(), tmp.begin(), this->begin(),
                                        std::multiplies<FieldValueType>());
-                        return result;
+                        return *this;
                     }
-                    std::transform(other.begin(), other.end(), result.begin(), result.begin(),
+                    std::transform(other.begin(), other.end(), this->begin(), this->begin(),
                                    std::multiplies<FieldValueType>());
+                    return *this;
+                }
+
+                /**
+                 * Computes the standard polynomial addition, polynomial A + polynomial B, and stores result in
+                 * polynomial C.
+                 */
+                polynomial_dfs operator+(const polynomial_dfs& other) const {
+                    polynomial_dfs result(*this);
+                    result += other;
+                    return result;
+                }
+
+                polynomial_dfs operator-() const {
+                    polynomial_dfs result(this->_d, this->size());
+                    std::transform(this->begin(), this->end(), result.begin(), std::negate<FieldValueType>());
+                    return result;
+                }
+
+                /**
+                 * Computes the standard polynomial subtraction, polynomial A - polynomial B, and stores result in
+                 * polynomial C.
+                 */
+                polynomial_dfs operator-(const polynomial_dfs& other) const {
+                    polynomial_dfs result(*this);
+                    result -= other;
                     return result;
                 }
 
                 /**
-                 * Perform the standard Euclidean Division algorithm.
+                 * Perform the multiplication of two polynomials, polynomial A * polynomial B, and stores result in
+                 * polynomial C.
+                 */
+                polynomial_dfs operator*(const polynomial_dfs& other) const {
+                    polynomial_dfs result(*this);
+                    result *= other;
+                    return result;
+                }
+
+                /**
+                 * Perform the Euclidean Division algorithm on the coefficients, see math::division.
                  * Input: Polynomial A, Polynomial B, where A / B
                  * Output: Polynomial Q, such that A = (Q * B) + R.
                  */
                 polynomial_dfs operator/(const polynomial_dfs& other) const {
-                    std::vector<FieldValueType> x = this->coefficients();
-                    std::vector<FieldValueType> y = other.coefficients();
+                    std::vector<FieldValueType> q, r;
+                    division(q, r, *this->coefficients_ptr(), *other.coefficients_ptr());
+                    return from_division(q);
+                }
 
-                    std::size_t d = y.size() - 1;           /* Degree of B */
-                    FieldValueType c = y.back().inversed(); /* Inverse of Leading Coefficient of B */
+                /**
+                 * Perform the Euclidean Division algorithm on the coefficients, see math::division.
+                 * Input: Polynomial A, Polynomial B, where A / B
+                 * Output: Polynomial R, such that A = (Q * B) + R.
+                 */
+                polynomial_dfs operator%(const polynomial_dfs& other) const {
+                    std::vector<FieldValueType> q, r;
+                    division(q, r, *this->coefficients_ptr(), *other.coefficients_ptr());
+                    return from_division(r);
+                }
 
-                    std::vector<FieldValueType> r(x);
-                    std::vector<FieldValueType> q(r.size(), FieldValueType::zero());
+                void from_coefficients(const container_type &tmp) {
+                    typedef typename value_type::field_type FieldType;
+                    size_t n = detail::power_of_two(tmp.size());
+                    value_type omega = unity_root<FieldType>(n);
+                    _d = tmp.size() - 1;
+                    val.assign(tmp.begin(), tmp.end());
+                    val.resize(n, FieldValueType::zero());
+                    invalidate();
+                    detail::basic_serial_radix2_fft<FieldType>(val, omega);
+                }
 
-                    std::size_t r_deg = r.size() - 1;
-                    std::size_t shift;
+                /**
+                 * Coefficients of the polynomial without high zero coefficients, see cache_coefficients().
+                 */
+                std::vector<FieldValueType> coefficients() const {
+                    return *coefficients_ptr();
+                }
 
-                    while (r_deg >= d && (r.size() != 0)) {
-                        if (r_deg >= d) {
-                            shift = r_deg - d;
-                        } else {
-                            shift = 0;
-                        }
+                /**
+                 * Keeps the coefficient form, so coefficients(), evaluate, operator/, operator% and resize reuse
+                 * it instead of running the inverse transform until the evaluations are modified. Only writes
+                 * through iterators, references and data() pointers obtained after this call drop it: the ones
+                 * taken before must be taken again before writing through them.
+                 */
+                void cache_coefficients() const {
+                    if (!_coefficients_valid.load(std::memory_order_acquire)) {
+                        std::atomic_store(&_coefficients, coefficients_ptr());
+                        _coefficients_valid.store(true, std::memory_order_release);
+                    }
+                }
+
+            private:
+                /*
+                 * Mark the coefficient form stale before handing out write access. Only the flag is written, and
+                 * only when it is set, so element writes from parallel loops neither race nor contend on it.
+                 */
+                void invalidate() BOOST_NOEXCEPT {
+                    if (_coefficients_valid.load(std::memory_order_relaxed)) {
+                        _coefficients_valid.store(false, std::memory_order_release);
+                    }
+                }
 
-                        FieldValueType lead_coeff = r.back() * c;
+                /*
+                 * Forget the coefficient form. Only for members that own the object, such as assignments and
+                 * moves, as the pointer itself is written.
+                 */
+                void drop_coefficients() BOOST_NOEXCEPT {
+                    _coefficients.reset();
+                    _coefficients_valid.store(false, std::memory_order_release);
+                }
 
-                        q[shift] += lead_coeff;
+                /*
+                 * The cached coefficient form if it is still valid, null otherwise.
+                 */
+                std::shared_ptr<const std::vector<FieldValueType>> valid_coefficients() const {
+                    if (_coefficients_valid.load(std::memory_order_acquire)) {
+                        return std::atomic_load(&_coefficients);
+                    }
+                    return nullptr;
+                }
 
-                        if (y.size() + shift + 1 > r.size()) {
-                            r.resize(y.size() + shift + 1);
-                        }
-                        auto glambda = [=](const FieldValueType& x, const FieldValueType& y) {
-                            return y - (x * lead_coeff);
-                        };
-                        std::transform(y.begin(), y.end(), r.begin() + shift, r.begin() + shift, glambda);
-
-                        size_t new_s = r.size();
-                        while (new_s > 0 && r[new_s - 1] == FieldValueType(0)) {
-                            --new_s;
-                        }
-                        r.resize(new_s);
+                template<typename InputIterator>
+                static std::shared_ptr<const std::vector<FieldValueType>> trimmed(InputIterator first,
+                                                                                InputIterator last) {
+                    std::vector<FieldValueType> c(first, last);
+                    while (!c.empty() && c.back() == FieldValueType::zero()) {
+                        c.pop_back();
+                    }
+                    return std::make_shared<const std::vector<FieldValueType>>(std::move(c));
+                }
 
-                        r_deg = r.size() - 1;
+                /*
+                 * The cached coefficient form if it is valid, otherwise the one of the current evaluations,
+                 * which is not kept. A moved-from polynomial has no evaluations and no coefficients.
+                 */
+                std::shared_ptr<const std::vector<FieldValueType>> coefficients_ptr() const {
+                    std::shared_ptr<const std::vector<FieldValueType>> c = valid_coefficients();
+                    if (c) {
+                        return c;
                     }
-                    size_t new_s = q.size();
-                    while (new_s > 0 && q[new_s - 1] == FieldValueType(0)) {
-                        --new_s;
+                    if (this->val.empty()) {
+                        return std::make_shared<const std::vector<FieldValueType>>();
                     }
-                    q.resize(new_s);
 
-                    typedef typename value_type::field_type FieldType;
-                    size_t n = this->size();
-                    value_type omega = unity_root<FieldType>(n);
-                    q.resize(n);
-                    detail::basic_serial_radix2_fft<FieldType>(q, omega);
-                    return polynomial_dfs(new_s - 1, q);
+                    std::vector<FieldValueType> tmp(this->val.begin(), this->val.end());
+                    inverse_transform(tmp);
+                    while (!tmp.empty() && tmp.back() == FieldValueType::zero()) {
+                        tmp.pop_back();
+                    }
+                    return std::make_shared<const std::vector<FieldValueType>>(std::move(tmp));
                 }
 
-                /**
-                 * Perform the standard Euclidean Division algorithm.
-                 * Input: Polynomial A, Polynomial B, where A / B
-                 * Output: Polynomial R, such that A = (Q * B) + R.
+                /*
+                 * Replace the evaluations in v by the coefficients they come from.
                  */
-                polynomial_dfs operator%(const polynomial_dfs& other) const {
-                    std::vector<FieldValueType> x = this->coefficients();
-                    std::vector<FieldValueType> y = other.coefficients();
-
-                    std::size_t d = y.size() - 1;           /* Degree of B */
-                    FieldValueType c = y.back().inversed(); /* Inverse of Leading Coefficient of B */
+                template<typename Container>
+                static void inverse_transform(Container &v) {
+                    typedef typename value_type::field_type FieldType;
 
-                    std::vector<FieldValueType> r(x);
+                    value_type omega = unity_root<FieldType>(v.size());
+#ifdef MULTICORE
+                    detail::basic_parallel_radix2_fft<FieldType>(v, omega.inversed());
+#else
+                    detail::basic_serial_radix2_fft<FieldType>(v, omega.inversed());
+#endif
+                    const value_type sconst = value_type(v.size()).inversed();
+                    std::transform(v.begin(),
+                                   v.end(),
+                                   v.begin(),
+                                   std::bind(std::multiplies<value_type>(), sconst, std::placeholders::_1));
+                }
 
-                    std::size_t r_deg = r.size() - 1;
-                    std::size_t shift;
+                /*
+                 * Evaluations over the domain of this polynomial of a quotient or remainder given by coefficients,
+                 * which the result keeps as its coefficient form.
+                 */
+                polynomial_dfs from_division(std::vector<FieldValueType> &c) const {
+                    typedef typename value_type::field_type FieldType;
 
-                    while (r_deg >= d && (r.size() != 0)) {
-                        if (r_deg >= d) {
-                            shift = r_deg - d;
-                        } else {
-                            shift = 0;
-                        }
+                    const std::size_t d = c.size() - 1;
+                    const std::size_t n = std::max(this->size(), detail::power_of_two(c.size()));
+                    std::shared_ptr<const std::vector<FieldValueType>> coefficients = trimmed(c.begin(), c.end());
+                    c.resize(n, FieldValueType::zero());
+                    detail::basic_serial_radix2_fft<FieldType>(c, unity_root<FieldType>(n));
+                    polynomial_dfs result(d, c.begin(), c.end());
+                    result._coefficients = std::move(coefficients);
+                    result._coefficients_valid.store(true, std::memory_order_relaxed);
+                    return result;
+                }
+            };
 
-                        FieldValueType lead_coeff = r.back() * c;
+            /**
+             * Divide polynomial F given by its evaluations by x - z without leaving the evaluation form: the
+             * quotient takes the values (F(omega^i) - F(z)) / (omega^i - z), whose denominators are inverted in
+             * batches. Stores the quotient in Q and returns F(z). When z = omega^j is a point of the domain the
+             * quotient there is F'(z) = -z^{-1} * sum_{i != j} Q(omega^i) * omega^i.
+             */
+            template<typename FieldValueType, typename Allocator>
+            FieldValueType synthetic_division(polynomial_dfs<FieldValueType, Allocator> &q,
+                                              const polynomial_dfs<FieldValueType, Allocator> &f,
+                                              const FieldValueType &z) {
+                typedef typename FieldValueType::field_type FieldType;
+
+                const std::size_t n = f.size();
+                const std::size_t block = detail::evaluation_block_size;
+                const FieldValueType omega = unity_root<FieldType>(n);
+
+                /* inv_i = 1 / (omega^i - z) and w_i = omega^i * inv_i, with inv_j = 0 at a domain point z */
+                std::vector<FieldValueType> inv(n);
+                std::vector<FieldValueType> w(n);
+                std::size_t j = n;
 
-                        if (y.size() + shift + 1 > r.size()) {
-                            r.resize(y.size() + shift + 1);
-                        }
-                        auto glambda = [=](const FieldValueType& x, const FieldValueType& y) {
-                            return y - (x * lead_coeff);
-                        };
-                        std::transform(y.begin(), y.end(), r.begin() + shift, r.begin() + shift, glambda);
-
-                        size_t new_s = r.size();
-                        while (new_s > 0 && r[new_s - 1] == FieldValueType(0)) {
-                            --new_s;
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                for (std::size_t start = 0; start < n; start += block) {
+                    const std::size_t end = std::min(start + block, n);
+                    std::size_t hit = end;
+                    FieldValueType omega_i = omega.pow(start);
+                    for (std::size_t i = start; i < end; ++i, omega_i *= omega) {
+                        w[i] = omega_i;
+                        inv[i] = omega_i - z;
+                        if (inv[i] == FieldValueType::zero()) {
+                            inv[i] = FieldValueType::one();
+                            hit = i;
                         }
-                        r.resize(new_s);
-
-                        r_deg = r.size() - 1;
                     }
 
-                    typedef typename value_type::field_type FieldType;
-                    size_t n = this->size();
-                    value_type omega = unity_root<FieldType>(n);
-                    r.resize(n);
-                    detail::basic_serial_radix2_fft<FieldType>(r, omega);
-                    return polynomial_dfs(r_deg, r);
+                    std::vector<FieldValueType> d(inv.begin() + start, inv.begin() + end);
+                    detail::batch_inversion(d);
+                    for (std::size_t i = start; i < end; ++i) {
+                        inv[i] = i == hit ? FieldValueType::zero() : d[i - start];
+                        w[i] *= inv[i];
+                    }
+                    if (hit != end) {
+                        j = hit;
+                    }
                 }
 
-                void from_coefficients(const container_type &tmp) {
-                    typedef typename value_type::field_type FieldType;
-                    size_t n = detail::power_of_two(tmp.size());
-                    value_type omega = unity_root<FieldType>(n);
-                    _d = tmp.size() - 1;
-                    val.assign(tmp.begin(), tmp.end());
-                    val.resize(n, FieldValueType::zero());
-                    detail::basic_serial_radix2_fft<FieldType>(val, omega);
+                FieldValueType value;
+                if (j == n) {
+                    value = -(z.pow(n) - FieldValueType::one()) * FieldValueType(n).inversed() *
+                            detail::inner_product(f.data(), w.data(), n);
+                } else {
+                    value = f[j];
                 }
 
-                std::vector<FieldValueType> coefficients() const {
-                    typedef typename value_type::field_type FieldType;
-
-                    value_type omega = unity_root<FieldType>(this->size());
-                    std::vector<FieldValueType> tmp(this->begin(), this->end());
+                polynomial_dfs<FieldValueType, Allocator> result(f.degree() > 0 ? f.degree() - 1 : 0, n);
 #ifdef MULTICORE
-                    detail::basic_parallel_radix2_fft<FieldType>(c, omega.inversed());
-#else
-                    detail::basic_serial_radix2_fft<FieldType>(tmp, omega.inversed());
+#pragma omp parallel for schedule(static)
 #endif
-                    const value_type sconst = value_type(this->size()).inversed();
-                    std::transform(tmp.begin(),
-                                   tmp.end(),
-                                   tmp.begin(),
-                                   std::bind(std::multiplies<value_type>(), sconst, std::placeholders::_1));
-                    size_t r_size = tmp.size();
-                    while (r_size > 0 && tmp[r_size - 1] == FieldValueType(0)) {
-                        --r_size;
-                    }
-                    tmp.resize(r_size);
-                    return tmp;
+                for (std::size_t i = 0; i < n; ++i) {
+                    result[i] = (f[i] - value) * inv[i];
                 }
-            };
+                if (j != n) {
+                    std::vector<FieldValueType> difference(n);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        difference[i] = f[i] - value;
+                    }
+                    result[j] = -z.inversed() * detail::inner_product(difference.data(), w.data(), n);
+                }
+
+                q = std::move(result);
+                return value;
+            }
+
+            /*
+             * Sums and products with an rvalue operand reuse its buffer.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator+(polynomial_dfs<FieldValueType, Allocator>&& A,
+                                                                const polynomial_dfs<FieldValueType, Allocator>& B) {
+                A += B;
+                return std::move(A);
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator+(const polynomial_dfs<FieldValueType, Allocator>& A,
+                                                                polynomial_dfs<FieldValueType, Allocator>&& B) {
+                B += A;
+                return std::move(B);
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator+(polynomial_dfs<FieldValueType, Allocator>&& A,
+                                                                polynomial_dfs<FieldValueType, Allocator>&& B) {
+                A += B;
+                return std::move(A);
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator-(polynomial_dfs<FieldValueType, Allocator>&& A,
+                                                                const polynomial_dfs<FieldValueType, Allocator>& B) {
+                A -= B;
+                return std::move(A);
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator-(polynomial_dfs<FieldValueType, Allocator>&& A,
+                                                                polynomial_dfs<FieldValueType, Allocator>&& B) {
+                A -= B;
+                return std::move(A);
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator*(polynomial_dfs<FieldValueType, Allocator>&& A,
+                                                                const polynomial_dfs<FieldValueType, Allocator>& B) {
+                A *= B;
+                return std::move(A);
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator*(const polynomial_dfs<FieldValueType, Allocator>& A,
+                                                                polynomial_dfs<FieldValueType, Allocator>&& B) {
+                B *= A;
+                return std::move(B);
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator*(polynomial_dfs<FieldValueType, Allocator>&& A,
+                                                                polynomial_dfs<FieldValueType, Allocator>&& B) {
+                A *= B;
+                return std::move(A);
+            }
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/evaluate.hpp>
 #include <string_view>
 
 namespace nil {
@@ -318,37 +319,18 @@ namespace nil {
                     std::swap(_d, other._d);
                 }
 
-                //                std::vector<FieldValueType> evaluate(const std::vector<FieldValueType>& value) const {
-                //                    typedef typename value_type::field_type FieldType;
-                //                    const std::size_t n = detail::power_of_two(this->_d);
-                //
-                //                    std::vector<FieldValueType> c(this->begin(), this->begin() + n);
-                //#ifdef MULTICORE
-                //                    detail::basic_parallel_radix2_fft<FieldType>(c, omega.inversed());
-                //#else
-                //                    detail::basic_serial_radix2_fft<FieldType>(c, (this->_omega).inversed());
-                //#endif
-                //                    std::vector<FieldValueType> result(value.size(), 0);
-                //                    auto end = c.end();
-                //                    while (end != c.begin()) {
-                //                        for (size_t i = 0; i < value.size(); ++i) {
-                //                            result[i] = result[i] * value[i] + *--end;
-                //                        }
-                //                    }
-                //                    return result;
-                //                }
+                /**
+                 * Evaluates the polynomial at every point of values from its coefficients, see evaluate_at_points.
+                 */
+                std::vector<FieldValueType> evaluate(const std::vector<FieldValueType>& values) const {
+                    return evaluate_at_points(this->coefficients(), values);
+                }
 
+                /**
+                 * Evaluates the polynomial at value straight from its evaluations, see barycentric_evaluate_at.
+                 */
                 FieldValueType evaluate(const FieldValueType& value) const {
-
-                    typedef typename value_type::field_type FieldType;
-
-                    std::vector<FieldValueType> tmp = this->coefficients();
-                    FieldValueType result = 0;
-                    auto end = tmp.end();
-                    while (end != tmp.begin()) {
-                        result = result * value + *--end;
-                    }
-                    return result;
+                    return barycentric_evaluate_at(*this, value);
                 }
 
                 /**
@@ -0,0 +1,429 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_POLYNOMIAL_EXPRESSION_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_POLYNOMIAL_EXPRESSION_HPP
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            /*
+             * Lazy arithmetic on coefficient-form polynomials. lazy(p) wraps a polynomial into an expression;
+             * +, -, * and scaling by field elements build a tree which is only evaluated when it is converted to
+             * a polynomial:
+             *
+             *     polynomial<value_type> r = lazy(a) + lazy(b) * c - value_type(3) * lazy(d) * e;
+             *
+             * An operation is only deferred when one of its operands is an expression: b * c on two polynomials
+             * is still computed right away by polynomial::operator*.
+             * The expression is flattened into a sum of scaled products. All linear terms are summed in a single
+             * pass over the output. Products of large operands are summed in the evaluation domain: each distinct
+             * operand is transformed once at a common size and a single inverse FFT recovers the whole sum.
+             * Expressions refer to their operands, so they must be evaluated before the operands change or go
+             * out of scope; they are not meant to be stored.
+             */
+            namespace detail {
+                template<typename ValueType>
+                struct expression_factor {
+                    const ValueType *data;
+                    std::size_t size;
+
+                    bool operator<(const expression_factor &other) const {
+                        return data < other.data || (data == other.data && size < other.size);
+                    }
+                };
+
+                /*
+                 * coefficient * factors[0] * factors[1] * ...
+                 */
+                template<typename ValueType>
+                struct expression_term {
+                    ValueType coefficient;
+                    std::vector<expression_factor<ValueType>> factors;
+                };
+
+                template<typename ValueType>
+                struct expression_terms {
+                    std::vector<expression_term<ValueType>> terms;
+                    /* Materialized subexpressions and products; a list keeps their addresses stable */
+                    std::list<std::vector<ValueType>> storage;
+
+                    expression_factor<ValueType> store(std::vector<ValueType> &&v) {
+                        storage.push_back(std::move(v));
+                        return {storage.back().data(), storage.back().size()};
+                    }
+                };
+
+                template<typename ValueType>
+                std::vector<ValueType> evaluate_expression_terms(expression_terms<ValueType> &ctx) {
+                    typedef typename ValueType::field_type FieldType;
+
+                    std::vector<expression_term<ValueType>> linear;
+                    std::vector<const expression_term<ValueType> *> transformed;
+                    std::size_t transform_size = 0;
+
+                    for (const expression_term<ValueType> &term : ctx.terms) {
+                        std::size_t result_size = 1;
+                        std::size_t shortest = term.factors.front().size;
+                        for (const expression_factor<ValueType> &f : term.factors) {
+                            result_size += f.size - 1;
+                            shortest = std::min(shortest, f.size);
+                        }
+                        if (shortest == 0 || term.coefficient == ValueType::zero()) {
+                            continue;
+                        }
+
+                        if (term.factors.size() == 1) {
+                            linear.push_back(term);
+                        } else if (shortest >= fft_multiplication_threshold) {
+                            transformed.push_back(&term);
+                            transform_size = std::max(transform_size, result_size);
+                        } else {
+                            std::vector<ValueType> product(term.factors.front().data,
+                                                           term.factors.front().data + term.factors.front().size);
+                            for (std::size_t j = 1; j < term.factors.size(); j++) {
+                                std::vector<ValueType> next(product.size() + term.factors[j].size - 1,
+                                                            ValueType::zero());
+                                multiply_add(next.data(), product.data(), product.size(), term.factors[j].data,
+                                             term.factors[j].size);
+                                product.swap(next);
+                            }
+                            linear.push_back({term.coefficient, {ctx.store(std::move(product))}});
+                        }
+                    }
+
+                    if (!transformed.empty()) {
+                        const std::size_t n = power_of_two(transform_size);
+                        const ValueType omega = unity_root<FieldType>(n);
+
+                        std::map<expression_factor<ValueType>, std::vector<ValueType>> images;
+                        std::vector<ValueType> sum(n, ValueType::zero());
+                        std::vector<ValueType> product(n);
+                        for (const expression_term<ValueType> *term : transformed) {
+                            std::fill(product.begin(), product.end(), term->coefficient);
+                            for (const expression_factor<ValueType> &f : term->factors) {
+                                std::vector<ValueType> &image = images[f];
+                                if (image.empty()) {
+                                    image.assign(n, ValueType::zero());
+                                    std::copy(f.data, f.data + f.size, image.begin());
+#ifdef MULTICORE
+                                    basic_parallel_radix2_fft<FieldType>(image, omega);
+#else
+                                    basic_serial_radix2_fft<FieldType>(image, omega);
+#endif
+                                }
+                                for (std::size_t i = 0; i < n; i++) {
+                                    product[i] *= image[i];
+                                }
+                            }
+                            for (std::size_t i = 0; i < n; i++) {
+                                sum[i] += product[i];
+                            }
+                        }
+
+#ifdef MULTICORE
+                        basic_parallel_radix2_fft<FieldType>(sum, omega.inversed());
+#else
+                        basic_serial_radix2_fft<FieldType>(sum, omega.inversed());
+#endif
+                        const ValueType sconst = ValueType(n).inversed();
+                        sum.resize(transform_size);
+                        for (ValueType &c : sum) {
+                            c *= sconst;
+                        }
+                        linear.push_back({ValueType::one(), {ctx.store(std::move(sum))}});
+                    }
+
+                    if (linear.empty()) {
+                        return std::vector<ValueType>(1, ValueType::zero());
+                    }
+
+                    /* Longest first, so the first term covers every coefficient of the result */
+                    std::stable_sort(linear.begin(), linear.end(),
+                                     [](const expression_term<ValueType> &x, const expression_term<ValueType> &y) {
+                                         return x.factors.front().size > y.factors.front().size;
+                                     });
+
+                    /* Sign of the unit coefficients, which are added without a multiplication */
+                    std::vector<int> unit(linear.size(), 0);
+                    for (std::size_t j = 0; j < linear.size(); j++) {
+                        if (linear[j].coefficient == ValueType::one()) {
+                            unit[j] = 1;
+                        } else if (linear[j].coefficient == -ValueType::one()) {
+                            unit[j] = -1;
+                        }
+                    }
+
+                    const std::size_t size = linear.front().factors.front().size;
+                    std::vector<ValueType> result(size);
+                    for (std::size_t i = 0; i < size; i++) {
+                        const ValueType *first = linear.front().factors.front().data;
+                        ValueType c = unit[0] > 0 ? first[i] :
+                                      unit[0] < 0 ? -first[i] :
+                                                    linear.front().coefficient * first[i];
+                        for (std::size_t j = 1; j < linear.size() && i < linear[j].factors.front().size; j++) {
+                            const ValueType &x = linear[j].factors.front().data[i];
+                            if (unit[j] > 0) {
+                                c += x;
+                            } else if (unit[j] < 0) {
+                                c -= x;
+                            } else {
+                                c += linear[j].coefficient * x;
+                            }
+                        }
+                        result[i] = c;
+                    }
+
+                    condense(result);
+                    return result;
+                }
+            }    // namespace detail
+
+            template<typename Derived, typename ValueType>
+            struct polynomial_expression {
+                typedef ValueType value_type;
+
+                const Derived &derived() const {
+                    return static_cast<const Derived &>(*this);
+                }
+
+                /*
+                 * Append the factors of this expression to factors and return its scalar multiplier. Linear
+                 * combinations are evaluated and enter products as a single factor.
+                 */
+                value_type factor(detail::expression_terms<value_type> &ctx,
+                                  std::vector<detail::expression_factor<value_type>> &factors) const {
+                    factors.push_back(ctx.store(coefficients()));
+                    return value_type::one();
+                }
+
+                std::vector<value_type> coefficients() const {
+                    detail::expression_terms<value_type> ctx;
+                    derived().collect(ctx, value_type::one());
+                    return detail::evaluate_expression_terms(ctx);
+                }
+
+                template<typename Allocator>
+                operator polynomial<value_type, Allocator>() const {
+                    const std::vector<value_type> c = coefficients();
+                    return polynomial<value_type, Allocator>(c.begin(), c.end());
+                }
+            };
+
+            template<typename ValueType>
+            struct polynomial_terminal : public polynomial_expression<polynomial_terminal<ValueType>, ValueType> {
+                template<typename Allocator>
+                polynomial_terminal(const polynomial<ValueType, Allocator> &p) : data(p.data()), size(p.size()) {
+                }
+
+                void collect(detail::expression_terms<ValueType> &ctx, const ValueType &coefficient) const {
+                    ctx.terms.push_back({coefficient, {{data, size}}});
+                }
+
+                ValueType factor(detail::expression_terms<ValueType> &,
+                                 std::vector<detail::expression_factor<ValueType>> &factors) const {
+                    factors.push_back({data, size});
+                    return ValueType::one();
+                }
+
+                const ValueType *data;
+                std::size_t size;
+            };
+
+            template<typename L, typename R>
+            struct polynomial_sum : public polynomial_expression<polynomial_sum<L, R>, typename L::value_type> {
+                typedef typename L::value_type value_type;
+
+                polynomial_sum(const L &l, const R &r) : l(l), r(r) {
+                }
+
+                void collect(detail::expression_terms<value_type> &ctx, const value_type &coefficient) const {
+                    l.collect(ctx, coefficient);
+                    r.collect(ctx, coefficient);
+                }
+
+                L l;
+                R r;
+            };
+
+            template<typename L, typename R>
+            struct polynomial_difference
+                : public polynomial_expression<polynomial_difference<L, R>, typename L::value_type> {
+                typedef typename L::value_type value_type;
+
+                polynomial_difference(const L &l, const R &r) : l(l), r(r) {
+                }
+
+                void collect(detail::expression_terms<value_type> &ctx, const value_type &coefficient) const {
+                    l.collect(ctx, coefficient);
+                    r.collect(ctx, -coefficient);
+                }
+
+                L l;
+                R r;
+            };
+
+            template<typename E>
+            struct polynomial_scaled : public polynomial_expression<polynomial_scaled<E>, typename E::value_type> {
+                typedef typename E::value_type value_type;
+
+                polynomial_scaled(const E &e, const value_type &scalar) : e(e), scalar(scalar) {
+                }
+
+                void collect(detail::expression_terms<value_type> &ctx, const value_type &coefficient) const {
+                    e.collect(ctx, coefficient * scalar);
+                }
+
+                value_type factor(detail::expression_terms<value_type> &ctx,
+                                  std::vector<detail::expression_factor<value_type>> &factors) const {
+                    return e.factor(ctx, factors) * scalar;
+                }
+
+                E e;
+                value_type scalar;
+            };
+
+            template<typename L, typename R>
+            struct polynomial_product : public polynomial_expression<polynomial_product<L, R>, typename L::value_type> {
+                typedef typename L::value_type value_type;
+
+                polynomial_product(const L &l, const R &r) : l(l), r(r) {
+                }
+
+                void collect(detail::expression_terms<value_type> &ctx, const value_type &coefficient) const {
+                    detail::expression_term<value_type> term;
+                    term.coefficient = coefficient * factor(ctx, term.factors);
+                    ctx.terms.push_back(std::move(term));
+                }
+
+                value_type factor(detail::expression_terms<value_type> &ctx,
+                                  std::vector<detail::expression_factor<value_type>> &factors) const {
+                    const value_type scalar = l.factor(ctx, factors);
+                    return scalar * r.factor(ctx, factors);
+                }
+
+                L l;
+                R r;
+            };
+
+            template<typename T, typename = void>
+            struct is_polynomial_expression : std::false_type { };
+
+            template<typename T>
+            struct is_polynomial_expression<
+                T, typename std::enable_if<
+                       std::is_base_of<polynomial_expression<T, typename T::value_type>, T>::value>::type>
+                : std::true_type { };
+
+            namespace detail {
+                template<typename T, typename = void>
+                struct as_polynomial_expression {
+                    typedef void type;
+                };
+
+                template<typename ValueType, typename Allocator>
+                struct as_polynomial_expression<polynomial<ValueType, Allocator>> {
+                    typedef polynomial_terminal<ValueType> type;
+                };
+
+                template<typename T>
+                struct as_polynomial_expression<T, typename std::enable_if<is_polynomial_expression<T>::value>::type> {
+                    typedef T type;
+                };
+
+                /* At least one operand is an expression and the other one an expression or a polynomial */
+                template<typename L, typename R>
+                struct polynomial_expression_operands {
+                    typedef typename as_polynomial_expression<L>::type left_type;
+                    typedef typename as_polynomial_expression<R>::type right_type;
+
+                    constexpr static const bool value = !std::is_void<left_type>::value &&
+                                                        !std::is_void<right_type>::value &&
+                                                        (std::is_same<left_type, L>::value ||
+                                                         std::is_same<right_type, R>::value);
+                };
+            }    // namespace detail
+
+            /*
+             * Start an expression on p, see polynomial_expression.
+             */
+            template<typename ValueType, typename Allocator>
+            polynomial_terminal<ValueType> lazy(const polynomial<ValueType, Allocator> &p) {
+                return polynomial_terminal<ValueType>(p);
+            }
+
+            template<typename L, typename R,
+                     typename = typename std::enable_if<detail::polynomial_expression_operands<L, R>::value>::type>
+            polynomial_sum<typename detail::as_polynomial_expression<L>::type,
+                           typename detail::as_polynomial_expression<R>::type>
+                operator+(const L &l, const R &r) {
+                return {l, r};
+            }
+
+            template<typename L, typename R,
+                     typename = typename std::enable_if<detail::polynomial_expression_operands<L, R>::value>::type>
+            polynomial_difference<typename detail::as_polynomial_expression<L>::type,
+                                  typename detail::as_polynomial_expression<R>::type>
+                operator-(const L &l, const R &r) {
+                return {l, r};
+            }
+
+            template<typename L, typename R,
+                     typename = typename std::enable_if<detail::polynomial_expression_operands<L, R>::value>::type>
+            polynomial_product<typename detail::as_polynomial_expression<L>::type,
+                               typename detail::as_polynomial_expression<R>::type>
+                operator*(const L &l, const R &r) {
+                return {l, r};
+            }
+
+            template<typename E, typename = typename std::enable_if<is_polynomial_expression<E>::value>::type>
+            polynomial_scaled<E> operator-(const E &e) {
+                return {e, -E::value_type::one()};
+            }
+
+            template<typename E, typename = typename std::enable_if<is_polynomial_expression<E>::value>::type>
+            polynomial_scaled<E> operator*(const typename E::value_type &scalar, const E &e) {
+                return {e, scalar};
+            }
+
+            template<typename E, typename = typename std::enable_if<is_polynomial_expression<E>::value>::type>
+            polynomial_scaled<E> operator*(const E &e, const typename E::value_type &scalar) {
+                return {e, scalar};
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_POLYNOMIAL_EXPRESSION_HPP
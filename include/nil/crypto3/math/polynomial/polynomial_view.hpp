@@ -31,6 +31,7 @@
 #include <vector>
 
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/evaluate.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -115,7 +116,7 @@ namespace nil {
                 }
 
                 allocator_type get_allocator() const BOOST_NOEXCEPT {
-                    return it.__alloc();
+                    return it.get_allocator();
                 }
 
                 iterator begin() BOOST_NOEXCEPT {
@@ -302,12 +303,7 @@ namespace nil {
                 }
 
                 FieldValueType evaluate(const FieldValueType& value) const {
-                    FieldValueType result = 0;
-                    auto end = this->end();
-                    while (end != this->begin()) {
-                        result = result * value + *--end;
-                    }
-                    return result;
+                    return evaluate_at(*this, value);
                 }
 
                 /**
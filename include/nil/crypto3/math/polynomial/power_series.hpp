@@ -0,0 +1,218 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_POWER_SERIES_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_POWER_SERIES_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /*
+                 * The inverses of 0, 1, ..., n - 1 (with 0 mapped to 0) from a single field inversion, used to
+                 * integrate power series. Requires n to be below the field characteristic.
+                 */
+                template<typename ValueType>
+                scratch_vector<ValueType> integer_inverses(std::size_t n) {
+                    scratch_vector<ValueType> inv(std::max<std::size_t>(n, 2), ValueType::one());
+                    inv[0] = ValueType::zero();
+                    for (std::size_t i = 2; i < n; i++) {
+                        inv[i] = inv[i - 1] * ValueType(i);
+                    }
+                    if (n <= 2) {
+                        inv.resize(n);
+                        return inv;
+                    }
+                    ValueType acc = inv[n - 1].inversed();
+                    for (std::size_t i = n - 1; i >= 2; i--) {
+                        const ValueType prefix = inv[i - 1];
+                        inv[i] = acc * prefix;
+                        acc *= ValueType(i);
+                    }
+                    return inv;
+                }
+
+                /*
+                 * Write the n coefficients of log(f) mod x^n, the integral of f' / f, to out for f with f[0] = 1.
+                 * inv holds integer_inverses(m) for some m >= n.
+                 */
+                template<typename ValueType>
+                void power_series_log(ValueType *out,
+                                      const ValueType *f,
+                                      std::size_t f_size,
+                                      std::size_t n,
+                                      const scratch_vector<ValueType> &inv) {
+                    std::fill(out, out + n, ValueType::zero());
+                    const std::size_t f_n = std::min(f_size, n);
+                    if (f_n < 2) {
+                        return;
+                    }
+
+                    scratch_vector<ValueType> derivative(f_n - 1);
+                    for (std::size_t i = 1; i < f_n; i++) {
+                        derivative[i - 1] = f[i] * ValueType(i);
+                    }
+                    const scratch_vector<ValueType> f_inverse =
+                        power_series_inverse(scratch_vector<ValueType>(f, f + f_n), n - 1);
+
+                    scratch_vector<ValueType> quotient(derivative.size() + n - 2, ValueType::zero());
+                    multiply_add(quotient.data(), derivative.data(), derivative.size(), f_inverse.data(), n - 1);
+                    for (std::size_t i = 1; i < n; i++) {
+                        out[i] = quotient[i - 1] * inv[i];
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * Compute the logarithm of the power series F modulo x^n as the integral of F' / F, in O(M(n)).
+             * Input: Polynomial F with F(0) = 1, n below the field characteristic.
+             * Output: Polynomial G of size n with G(0) = 0, such that exp(G) = F mod x^n.
+             */
+            template<typename Range>
+            Range power_series_log(const Range &f, std::size_t n) {
+
+                typedef
+                    typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
+
+                if (f.size() == 0 || f[0] != value_type::one()) {
+                    throw std::invalid_argument("expected f[0] == 1");
+                }
+
+                typename detail::coefficient_buffer<Range>::type g(n);
+                detail::power_series_log(g.data(), &*std::begin(f), f.size(), n,
+                                         detail::integer_inverses<value_type>(n));
+                Range result;
+                detail::assign_coefficients(result, std::move(g));
+                return result;
+            }
+
+            /**
+             * Compute the exponential of the power series F modulo x^n by Newton iteration,
+             * G <- G * (1 + F - log(G)), which doubles the precision of G at every step, in O(M(n)).
+             * Products of many factors are then obtained as the exponential of the sum of their logarithms.
+             * Input: Polynomial F with F(0) = 0, n below the field characteristic.
+             * Output: Polynomial G of size n with G(0) = 1, such that log(G) = F mod x^n.
+             */
+            template<typename Range>
+            Range power_series_exp(const Range &f, std::size_t n) {
+
+                typedef
+                    typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
+
+                if (f.size() != 0 && f[0] != value_type::zero()) {
+                    throw std::invalid_argument("expected f[0] == 0");
+                }
+
+                const detail::scratch_vector<value_type> inv = detail::integer_inverses<value_type>(n);
+                const std::size_t f_size = f.size();
+
+                /* The scratch vectors hold up to 2n - 1 coefficients and are reused across the iterations */
+                typename detail::coefficient_buffer<Range>::type g(1, value_type::one());
+                typename detail::coefficient_buffer<Range>::type t;
+                detail::scratch_vector<value_type> e;
+                g.reserve(2 * n);
+                e.reserve(2 * n);
+                t.reserve(2 * n);
+
+                std::size_t k = 1;
+                while (k < n) {
+                    k = std::min(2 * k, n);
+
+                    e.resize(k);
+                    detail::power_series_log(e.data(), g.data(), g.size(), k, inv);
+                    for (std::size_t i = 0; i < k; i++) {
+                        e[i] = (i < f_size ? f[i] : value_type::zero()) - e[i];
+                    }
+                    e[0] += value_type::one();
+
+                    t.assign(g.size() + k - 1, value_type::zero());
+                    detail::multiply_add(t.data(), g.data(), g.size(), e.data(), k);
+                    t.resize(k, value_type::zero());
+                    g.swap(t);
+                }
+
+                g.resize(n, value_type::zero());
+                Range result;
+                detail::assign_coefficients(result, std::move(g));
+                return result;
+            }
+
+            /**
+             * Compute the square root of the power series F modulo x^n by Newton iteration,
+             * G <- (G + F / G) / 2, which doubles the precision of G at every step, in O(M(n)).
+             * Input: Polynomial F with F(0) = 1, over a field of odd characteristic.
+             * Output: Polynomial G of size n with G(0) = 1, such that G * G = F mod x^n.
+             */
+            template<typename Range>
+            Range power_series_sqrt(const Range &f, std::size_t n) {
+
+                typedef
+                    typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
+
+                if (f.size() == 0 || f[0] != value_type::one()) {
+                    throw std::invalid_argument("expected f[0] == 1");
+                }
+
+                const value_type half = value_type(2).inversed();
+                const std::size_t f_size = f.size();
+
+                typename detail::coefficient_buffer<Range>::type g(1, value_type::one());
+                detail::scratch_vector<value_type> t;
+                g.reserve(2 * n);
+                t.reserve(2 * n);
+
+                std::size_t k = 1;
+                while (k < n) {
+                    k = std::min(2 * k, n);
+
+                    const detail::scratch_vector<value_type> g_inverse =
+                        power_series_inverse(detail::scratch_vector<value_type>(g.begin(), g.end()), k);
+                    const std::size_t f_k = std::min(f_size, k);
+                    t.assign(f_k + k - 1, value_type::zero());
+                    detail::multiply_add(t.data(), &*std::begin(f), f_k, g_inverse.data(), k);
+                    t.resize(k, value_type::zero());
+
+                    g.resize(k, value_type::zero());
+                    for (std::size_t i = 0; i < k; i++) {
+                        g[i] = (g[i] + t[i]) * half;
+                    }
+                }
+
+                g.resize(n, value_type::zero());
+                Range result;
+                detail::assign_coefficients(result, std::move(g));
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_POWER_SERIES_HPP
@@ -26,24 +26,164 @@
 #ifndef CRYPTO3_MATH_POLYNOMIAL_SHIFT_HPP
 #define CRYPTO3_MATH_POLYNOMIAL_SHIFT_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
+            namespace detail {
+                /*
+                 * Coefficients scaled by one thread at a time in polynomial_shift.
+                 */
+                constexpr std::size_t shift_block_size = 1 << 12;
+            }    // namespace detail
+
+            /*
+             * f(x * a): coefficient i is scaled by a^i, by blocks in parallel when built with MULTICORE.
+             */
             template<typename FieldType>
             static inline polynomial<typename FieldType::value_type>
                 polynomial_shift(const polynomial<typename FieldType::value_type> &f,
                                  const typename FieldType::value_type &x) {
                 polynomial<typename FieldType::value_type> f_shifted(f);
-                typename FieldType::value_type x_power = x;
-                for (int i = 1; i < f.size(); i++) {
-                    f_shifted[i] = f_shifted[i] * x_power;
-                    x_power *= x;
+                const std::size_t n = f.size();
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                for (std::size_t start = 0; start < n; start += detail::shift_block_size) {
+                    typename FieldType::value_type x_power = x.pow(start);
+                    for (std::size_t i = start; i < std::min(start + detail::shift_block_size, n); i++) {
+                        f_shifted[i] = f_shifted[i] * x_power;
+                        x_power *= x;
+                    }
                 }
 
                 return f_shifted;
             }
+
+            /*
+             * Taylor shift f(x + a) in O(M(n)). With u_i = i! * f_i and v_j = a^j / j! the shifted coefficients
+             * are g_k = (1 / k!) * sum_{i >= k} u_i * v_{i - k}, a single product of reversed u by v. Needs the
+             * characteristic of the field to exceed deg f.
+             */
+            template<typename FieldType>
+            static inline polynomial<typename FieldType::value_type>
+                polynomial_taylor_shift(const polynomial<typename FieldType::value_type> &f,
+                                        const typename FieldType::value_type &a) {
+                typedef typename FieldType::value_type value_type;
+
+                const std::size_t n = f.size();
+                if (n <= 1) {
+                    return f;
+                }
+
+                std::vector<value_type> factorial(n);
+                factorial[0] = value_type::one();
+                for (std::size_t i = 1; i < n; i++) {
+                    factorial[i] = factorial[i - 1] * value_type(i);
+                }
+                std::vector<value_type> inverse_factorial(n);
+                inverse_factorial[n - 1] = factorial[n - 1].inversed();
+                for (std::size_t i = n - 1; i > 0; i--) {
+                    inverse_factorial[i - 1] = inverse_factorial[i] * value_type(i);
+                }
+
+                std::vector<value_type> u(n);
+                std::vector<value_type> v(n);
+                value_type a_power = value_type::one();
+                for (std::size_t i = 0; i < n; i++) {
+                    u[n - 1 - i] = f[i] * factorial[i];
+                    v[i] = a_power * inverse_factorial[i];
+                    a_power *= a;
+                }
+
+                std::vector<value_type> w;
+                multiplication(w, u, v);
+                w.resize(n, value_type::zero());
+
+                polynomial<typename FieldType::value_type> result(n);
+                for (std::size_t k = 0; k < n; k++) {
+                    result[k] = w[n - 1 - k] * inverse_factorial[k];
+                }
+                result.condense();
+                return result;
+            }
+
+            /*
+             * Composition f(g(x)) mod x^n by baby steps and giant steps: with k = ceil(sqrt(deg f + 1)) the
+             * powers g^0, ..., g^k are computed once, f is cut into blocks F_j of k coefficients, each F_j(g)
+             * is a linear combination of the baby steps and the blocks are joined by Horner's rule in g^k.
+             * Takes O(sqrt(deg f) * M(n) + deg f * n), the blocks are combined in parallel when built with
+             * MULTICORE.
+             */
+            template<typename FieldType>
+            static inline polynomial<typename FieldType::value_type>
+                polynomial_compose(const polynomial<typename FieldType::value_type> &f,
+                                   const polynomial<typename FieldType::value_type> &g,
+                                   std::size_t n) {
+                typedef typename FieldType::value_type value_type;
+                typedef std::vector<value_type> vector_type;
+
+                const std::size_t m = f.size();
+                if (n == 0 || m == 0) {
+                    return polynomial<value_type>();
+                }
+
+                const std::size_t k = std::max<std::size_t>(1, std::ceil(std::sqrt(double(m))));
+                auto truncate = [n](vector_type &c) { c.resize(std::min(c.size(), n)); };
+
+                std::vector<vector_type> baby(k + 1);
+                baby[0] = vector_type(1, value_type::one());
+                baby[1] = vector_type(g.begin(), g.end());
+                truncate(baby[1]);
+                for (std::size_t i = 2; i <= k; i++) {
+                    multiplication(baby[i], baby[i - 1], baby[1]);
+                    truncate(baby[i]);
+                }
+
+                const std::size_t blocks = (m + k - 1) / k;
+                std::vector<vector_type> inner(blocks);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                for (std::size_t j = 0; j < blocks; j++) {
+                    vector_type &c = inner[j];
+                    c.assign(n, value_type::zero());
+                    for (std::size_t i = 0; i < k && j * k + i < m; i++) {
+                        const value_type coefficient = f[j * k + i];
+                        if (coefficient == value_type::zero()) {
+                            continue;
+                        }
+                        for (std::size_t u = 0; u < baby[i].size(); u++) {
+                            c[u] += coefficient * baby[i][u];
+                        }
+                    }
+                }
+
+                vector_type result = std::move(inner[blocks - 1]);
+                for (std::size_t j = blocks - 1; j-- > 0;) {
+                    multiplication(result, result, baby[k]);
+                    truncate(result);
+                    result.resize(n, value_type::zero());
+                    for (std::size_t u = 0; u < n; u++) {
+                        result[u] += inner[j][u];
+                    }
+                }
+
+                polynomial<value_type> composed(std::move(result));
+                composed.condense();
+                return composed;
+            }
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,357 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_SMALL_POLYNOMIAL_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_SMALL_POLYNOMIAL_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/evaluate.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            /**
+             * Coefficient-form polynomial storing up to N coefficients inline and only spilling to the heap
+             * beyond that, for the many low-degree polynomials of tree and interpolation algorithms. Offers the
+             * arithmetic of polynomial, products and quotients that fit in N coefficients allocate nothing.
+             */
+            template<typename FieldValueType, std::size_t N = 8>
+            class small_polynomial {
+                typedef boost::container::small_vector<FieldValueType, N> container_type;
+
+                container_type val;
+
+            public:
+                typedef typename container_type::value_type value_type;
+                typedef typename container_type::reference reference;
+                typedef typename container_type::const_reference const_reference;
+                typedef typename container_type::size_type size_type;
+                typedef typename container_type::difference_type difference_type;
+                typedef typename container_type::pointer pointer;
+                typedef typename container_type::const_pointer const_pointer;
+                typedef typename container_type::iterator iterator;
+                typedef typename container_type::const_iterator const_iterator;
+                typedef typename container_type::reverse_iterator reverse_iterator;
+                typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+
+                /**
+                 * Number of coefficients stored without allocation.
+                 */
+                static constexpr std::size_t inline_capacity = N;
+
+                small_polynomial() : val(1, FieldValueType::zero()) {
+                }
+
+                explicit small_polynomial(size_type n) : val(n, FieldValueType::zero()) {
+                }
+
+                small_polynomial(size_type n, const value_type &x) : val(n, x) {
+                }
+
+                template<typename InputIterator>
+                small_polynomial(InputIterator first, InputIterator last) : val(first, last) {
+                }
+
+                small_polynomial(std::initializer_list<value_type> il) : val(il.begin(), il.end()) {
+                }
+
+                small_polynomial(const FieldValueType &value, std::size_t power = 0) :
+                    val(power + 1, FieldValueType::zero()) {
+                    val[power] = value;
+                }
+
+                template<typename Allocator>
+                explicit small_polynomial(const polynomial<FieldValueType, Allocator> &p) : val(p.begin(), p.end()) {
+                }
+
+                small_polynomial(const small_polynomial &) = default;
+                small_polynomial(small_polynomial &&) = default;
+                small_polynomial &operator=(const small_polynomial &) = default;
+                small_polynomial &operator=(small_polynomial &&) = default;
+
+                template<typename Allocator>
+                explicit operator polynomial<FieldValueType, Allocator>() const {
+                    return polynomial<FieldValueType, Allocator>(val.begin(), val.end());
+                }
+
+                bool operator==(const small_polynomial &rhs) const {
+                    return val == rhs.val;
+                }
+                bool operator!=(const small_polynomial &rhs) const {
+                    return !(rhs == *this);
+                }
+
+                template<typename InputIterator>
+                void assign(InputIterator first, InputIterator last) {
+                    val.assign(first, last);
+                }
+
+                void assign(size_type n, const_reference u) {
+                    val.assign(n, u);
+                }
+
+                iterator begin() BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+                const_iterator begin() const BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+                iterator end() BOOST_NOEXCEPT {
+                    return val.end();
+                }
+                const_iterator end() const BOOST_NOEXCEPT {
+                    return val.end();
+                }
+                reverse_iterator rbegin() BOOST_NOEXCEPT {
+                    return val.rbegin();
+                }
+                const_reverse_iterator rbegin() const BOOST_NOEXCEPT {
+                    return val.rbegin();
+                }
+                reverse_iterator rend() BOOST_NOEXCEPT {
+                    return val.rend();
+                }
+                const_reverse_iterator rend() const BOOST_NOEXCEPT {
+                    return val.rend();
+                }
+                const_iterator cbegin() const BOOST_NOEXCEPT {
+                    return begin();
+                }
+                const_iterator cend() const BOOST_NOEXCEPT {
+                    return end();
+                }
+
+                size_type size() const BOOST_NOEXCEPT {
+                    return val.size();
+                }
+                size_type degree() const BOOST_NOEXCEPT {
+                    return size() - 1;
+                }
+                size_type capacity() const BOOST_NOEXCEPT {
+                    return val.capacity();
+                }
+                bool empty() const BOOST_NOEXCEPT {
+                    return val.empty();
+                }
+                void reserve(size_type n) {
+                    val.reserve(n);
+                }
+
+                /**
+                 * True while the coefficients are stored inline.
+                 */
+                bool is_inline() const BOOST_NOEXCEPT {
+                    return val.capacity() == N;
+                }
+
+                reference operator[](size_type n) BOOST_NOEXCEPT {
+                    return val[n];
+                }
+                const_reference operator[](size_type n) const BOOST_NOEXCEPT {
+                    return val[n];
+                }
+                reference back() BOOST_NOEXCEPT {
+                    return val.back();
+                }
+                const_reference back() const BOOST_NOEXCEPT {
+                    return val.back();
+                }
+                value_type *data() BOOST_NOEXCEPT {
+                    return val.data();
+                }
+                const value_type *data() const BOOST_NOEXCEPT {
+                    return val.data();
+                }
+
+                void push_back(const_reference x) {
+                    val.push_back(x);
+                }
+                void pop_back() {
+                    val.pop_back();
+                }
+                void clear() BOOST_NOEXCEPT {
+                    val.clear();
+                }
+                void resize(size_type n) {
+                    val.resize(n, FieldValueType::zero());
+                }
+                void resize(size_type n, const_reference x) {
+                    val.resize(n, x);
+                }
+                void swap(small_polynomial &other) {
+                    val.swap(other.val);
+                }
+
+                FieldValueType evaluate(const FieldValueType &value) const {
+                    return evaluate_at(*this, value);
+                }
+
+                /**
+                 * Returns true if polynomial is a zero polynomial.
+                 */
+                bool is_zero() const {
+                    return std::all_of(this->begin(), this->end(),
+                                       [](const FieldValueType &i) { return i == FieldValueType::zero(); });
+                }
+
+                /**
+                 * Removes extraneous zero entries, the zero polynomial keeps a single coefficient.
+                 */
+                void condense() {
+                    while (val.size() > 1 && val.back() == FieldValueType::zero()) {
+                        val.pop_back();
+                    }
+                }
+
+                small_polynomial &operator+=(const small_polynomial &other) {
+                    if (other.size() > this->size()) {
+                        this->resize(other.size());
+                    }
+                    std::transform(other.begin(), other.end(), this->begin(), this->begin(),
+                                   std::plus<FieldValueType>());
+                    this->condense();
+                    return *this;
+                }
+
+                small_polynomial &operator-=(const small_polynomial &other) {
+                    if (other.size() > this->size()) {
+                        this->resize(other.size());
+                    }
+                    std::transform(this->begin(), this->begin() + other.size(), other.begin(), this->begin(),
+                                   std::minus<FieldValueType>());
+                    this->condense();
+                    return *this;
+                }
+
+                small_polynomial &operator*=(const small_polynomial &other) {
+                    small_polynomial result = *this * other;
+                    this->swap(result);
+                    return *this;
+                }
+
+                small_polynomial operator+(const small_polynomial &other) const {
+                    small_polynomial result(*this);
+                    result += other;
+                    return result;
+                }
+
+                small_polynomial operator-() const {
+                    small_polynomial result(this->size());
+                    std::transform(this->begin(), this->end(), result.begin(), std::negate<FieldValueType>());
+                    return result;
+                }
+
+                small_polynomial operator-(const small_polynomial &other) const {
+                    small_polynomial result(*this);
+                    result -= other;
+                    return result;
+                }
+
+                /**
+                 * Product computed straight into the result, see detail::multiply_add.
+                 */
+                small_polynomial operator*(const small_polynomial &other) const {
+                    const bool zero = this->empty() || other.empty();
+                    small_polynomial result(zero ? 1 : this->size() + other.size() - 1);
+                    if (!zero) {
+                        detail::multiply_add(result.data(), this->data(), this->size(), other.data(), other.size());
+                        result.condense();
+                    }
+                    return result;
+                }
+
+                /**
+                 * Perform the Euclidean Division algorithm, see math::division.
+                 * Output: Polynomial Q, such that A = (Q * B) + R.
+                 */
+                small_polynomial operator/(const small_polynomial &other) const {
+                    small_polynomial q, r;
+                    divide(q, r, other);
+                    return q;
+                }
+
+                /**
+                 * Perform the Euclidean Division algorithm, see math::division.
+                 * Output: Polynomial R, such that A = (Q * B) + R.
+                 */
+                small_polynomial operator%(const small_polynomial &other) const {
+                    small_polynomial q, r;
+                    divide(q, r, other);
+                    return r;
+                }
+
+            private:
+                void divide(small_polynomial &q, small_polynomial &r, const small_polynomial &other) const {
+                    small_polynomial u(*this), v(other);
+                    u.condense();
+                    v.condense();
+                    if (v.is_zero()) {
+                        throw std::invalid_argument("division by the zero polynomial");
+                    }
+
+                    if (u.size() < v.size()) {
+                        q = small_polynomial();
+                        r.swap(u);
+                        return;
+                    }
+                    detail::divide(q.val, r.val, u.data(), u.size(), v.data(), v.size());
+                    if (r.empty()) {
+                        r.push_back(FieldValueType::zero());
+                    }
+                    q.condense();
+                    r.condense();
+                }
+            };
+
+            template<typename FieldValueType, std::size_t N,
+                     typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
+            small_polynomial<FieldValueType, N> operator*(const small_polynomial<FieldValueType, N> &A,
+                                                          const FieldValueType &B) {
+                small_polynomial<FieldValueType, N> result(A);
+                for (FieldValueType &c : result) {
+                    c *= B;
+                }
+                result.condense();
+                return result;
+            }
+
+            template<typename FieldValueType, std::size_t N,
+                     typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
+            small_polynomial<FieldValueType, N> operator*(const FieldValueType &A,
+                                                          const small_polynomial<FieldValueType, N> &B) {
+                return B * A;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_SMALL_POLYNOMIAL_HPP
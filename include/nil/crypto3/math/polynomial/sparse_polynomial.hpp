@@ -0,0 +1,611 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_SPARSE_POLYNOMIAL_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_SPARSE_POLYNOMIAL_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /*
+                 * Output coefficients of a sparse product, or evaluations of a sparse polynomial, handled by one
+                 * thread at a time.
+                 */
+                constexpr std::size_t sparse_block_size = 1 << 12;
+
+                /*
+                 * Add a times the terms [first, last) to out, which holds a_size + degree coefficients. Every
+                 * output block collects the shifted copies of a that overlap it, so blocks are spread over threads
+                 * when built with MULTICORE.
+                 */
+                template<typename ValueType, typename TermIterator>
+                void sparse_multiply_add(ValueType *out,
+                                         std::size_t out_size,
+                                         const ValueType *a,
+                                         std::size_t a_size,
+                                         TermIterator first,
+                                         TermIterator last) {
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t start = 0; start < out_size; start += sparse_block_size) {
+                        const std::size_t end = std::min(start + sparse_block_size, out_size);
+                        for (TermIterator it = first; it != last; ++it) {
+                            const std::size_t lo = std::max(start, it->first);
+                            const std::size_t hi = std::min(end, it->first + a_size);
+                            for (std::size_t i = lo; i < hi; ++i) {
+                                out[i] += it->second * a[i - it->first];
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Add the values of the terms [first, last) at omega^0, ..., omega^{n - 1} to out. Term c x^e
+                 * contributes c (omega^e)^i, a running product restarted at every block.
+                 */
+                template<typename ValueType, typename TermIterator>
+                void sparse_evaluate_add(ValueType *out,
+                                         std::size_t n,
+                                         const ValueType &omega,
+                                         TermIterator first,
+                                         TermIterator last) {
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                    for (std::size_t start = 0; start < n; start += sparse_block_size) {
+                        const std::size_t end = std::min(start + sparse_block_size, n);
+                        for (TermIterator it = first; it != last; ++it) {
+                            const ValueType step = omega.pow(it->first % n);
+                            ValueType v = it->second * step.pow(start);
+                            for (std::size_t i = start; i < end; ++i) {
+                                out[i] += v;
+                                v *= step;
+                            }
+                        }
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * Polynomial stored as its nonzero terms, exponent/coefficient pairs sorted by exponent, for
+             * vanishing polynomials such as x^m - 1 and other few-term polynomials. Adding one to a polynomial
+             * or polynomial_dfs, multiplying by it or dividing by it costs O(n * terms) instead of a dense
+             * operation on degree-sized vectors.
+             */
+            template<typename FieldValueType>
+            class sparse_polynomial {
+            public:
+                typedef FieldValueType value_type;
+                typedef std::pair<std::size_t, FieldValueType> term_type;
+                typedef std::vector<term_type> container_type;
+                typedef typename container_type::size_type size_type;
+                typedef typename container_type::const_iterator const_iterator;
+                typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+
+            private:
+                container_type terms;
+
+                /* Sort the terms, merge equal exponents and drop zero coefficients */
+                void normalize() {
+                    std::stable_sort(terms.begin(), terms.end(),
+                                     [](const term_type &a, const term_type &b) { return a.first < b.first; });
+                    std::size_t k = 0;
+                    for (std::size_t i = 0; i < terms.size();) {
+                        term_type t = terms[i];
+                        for (++i; i < terms.size() && terms[i].first == t.first; ++i) {
+                            t.second += terms[i].second;
+                        }
+                        if (t.second != FieldValueType::zero()) {
+                            terms[k++] = t;
+                        }
+                    }
+                    terms.resize(k);
+                }
+
+                /* Merge the sorted terms of a and sign * b */
+                static sparse_polynomial merge(const sparse_polynomial &a, const sparse_polynomial &b, bool negate) {
+                    sparse_polynomial result;
+                    result.terms.reserve(a.terms.size() + b.terms.size());
+                    const_iterator i = a.begin(), j = b.begin();
+                    while (i != a.end() || j != b.end()) {
+                        if (j == b.end() || (i != a.end() && i->first < j->first)) {
+                            result.terms.push_back(*i++);
+                        } else if (i == a.end() || j->first < i->first) {
+                            result.terms.emplace_back(j->first, negate ? -j->second : j->second);
+                            ++j;
+                        } else {
+                            const FieldValueType c = negate ? i->second - j->second : i->second + j->second;
+                            if (c != FieldValueType::zero()) {
+                                result.terms.emplace_back(i->first, c);
+                            }
+                            ++i;
+                            ++j;
+                        }
+                    }
+                    return result;
+                }
+
+            public:
+                /**
+                 * The zero polynomial, which has no terms.
+                 */
+                sparse_polynomial() {
+                }
+
+                sparse_polynomial(const FieldValueType &value, std::size_t power = 0) {
+                    if (value != FieldValueType::zero()) {
+                        terms.emplace_back(power, value);
+                    }
+                }
+
+                /**
+                 * Terms in any order; equal exponents are summed and zero coefficients dropped.
+                 */
+                sparse_polynomial(std::initializer_list<term_type> il) : terms(il) {
+                    normalize();
+                }
+
+                template<typename InputIterator>
+                sparse_polynomial(InputIterator first, InputIterator last) : terms(first, last) {
+                    normalize();
+                }
+
+                /**
+                 * The nonzero coefficients of a dense polynomial.
+                 */
+                template<typename Allocator>
+                explicit sparse_polynomial(const polynomial<FieldValueType, Allocator> &p) {
+                    for (std::size_t i = 0; i < p.size(); ++i) {
+                        if (p[i] != FieldValueType::zero()) {
+                            terms.emplace_back(i, p[i]);
+                        }
+                    }
+                }
+
+                template<typename Allocator>
+                explicit operator polynomial<FieldValueType, Allocator>() const {
+                    polynomial<FieldValueType, Allocator> result(degree() + 1, FieldValueType::zero());
+                    for (const term_type &t : terms) {
+                        result[t.first] = t.second;
+                    }
+                    return result;
+                }
+
+                bool operator==(const sparse_polynomial &rhs) const {
+                    return terms == rhs.terms;
+                }
+                bool operator!=(const sparse_polynomial &rhs) const {
+                    return !(rhs == *this);
+                }
+
+                const_iterator begin() const BOOST_NOEXCEPT {
+                    return terms.begin();
+                }
+                const_iterator end() const BOOST_NOEXCEPT {
+                    return terms.end();
+                }
+                const_reverse_iterator rbegin() const BOOST_NOEXCEPT {
+                    return terms.rbegin();
+                }
+                const_reverse_iterator rend() const BOOST_NOEXCEPT {
+                    return terms.rend();
+                }
+
+                /**
+                 * Number of nonzero terms.
+                 */
+                size_type size() const BOOST_NOEXCEPT {
+                    return terms.size();
+                }
+                bool empty() const BOOST_NOEXCEPT {
+                    return terms.empty();
+                }
+                size_type degree() const BOOST_NOEXCEPT {
+                    return terms.empty() ? 0 : terms.back().first;
+                }
+                bool is_zero() const BOOST_NOEXCEPT {
+                    return terms.empty();
+                }
+
+                /**
+                 * Coefficient of x^power, found by binary search.
+                 */
+                FieldValueType operator[](std::size_t power) const {
+                    const_iterator it = std::lower_bound(
+                        terms.begin(), terms.end(), power,
+                        [](const term_type &t, std::size_t e) { return t.first < e; });
+                    return it != terms.end() && it->first == power ? it->second : FieldValueType::zero();
+                }
+
+                /**
+                 * Horner's rule over the gaps between consecutive exponents.
+                 */
+                FieldValueType evaluate(const FieldValueType &value) const {
+                    if (terms.empty()) {
+                        return FieldValueType::zero();
+                    }
+                    FieldValueType result = terms.back().second;
+                    for (std::size_t i = terms.size() - 1; i > 0; --i) {
+                        result = result * value.pow(terms[i].first - terms[i - 1].first) + terms[i - 1].second;
+                    }
+                    return result * value.pow(terms[0].first);
+                }
+
+                /**
+                 * Values at the powers of unity_root(n), i.e. the coefficients of the polynomial_dfs of size n,
+                 * in O(n * terms).
+                 */
+                std::vector<FieldValueType> evaluations(std::size_t n) const {
+                    typedef typename FieldValueType::field_type FieldType;
+
+                    std::vector<FieldValueType> result(n, FieldValueType::zero());
+                    detail::sparse_evaluate_add(result.data(), n, unity_root<FieldType>(n), terms.begin(),
+                                                terms.end());
+                    return result;
+                }
+
+                sparse_polynomial &operator+=(const sparse_polynomial &other) {
+                    *this = merge(*this, other, false);
+                    return *this;
+                }
+
+                sparse_polynomial &operator-=(const sparse_polynomial &other) {
+                    *this = merge(*this, other, true);
+                    return *this;
+                }
+
+                sparse_polynomial &operator*=(const sparse_polynomial &other) {
+                    *this = *this * other;
+                    return *this;
+                }
+
+                sparse_polynomial operator+(const sparse_polynomial &other) const {
+                    return merge(*this, other, false);
+                }
+
+                sparse_polynomial operator-() const {
+                    sparse_polynomial result(*this);
+                    for (term_type &t : result.terms) {
+                        t.second = -t.second;
+                    }
+                    return result;
+                }
+
+                sparse_polynomial operator-(const sparse_polynomial &other) const {
+                    return merge(*this, other, true);
+                }
+
+                sparse_polynomial operator*(const sparse_polynomial &other) const {
+                    sparse_polynomial result;
+                    result.terms.reserve(this->size() * other.size());
+                    for (const term_type &s : terms) {
+                        for (const term_type &t : other.terms) {
+                            result.terms.emplace_back(s.first + t.first, s.second * t.second);
+                        }
+                    }
+                    result.normalize();
+                    return result;
+                }
+            };
+
+            template<typename FieldValueType,
+                     typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
+            sparse_polynomial<FieldValueType> operator*(const sparse_polynomial<FieldValueType> &A,
+                                                        const FieldValueType &B) {
+                return A * sparse_polynomial<FieldValueType>(B);
+            }
+
+            template<typename FieldValueType,
+                     typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
+            sparse_polynomial<FieldValueType> operator*(const FieldValueType &A,
+                                                        const sparse_polynomial<FieldValueType> &B) {
+                return B * A;
+            }
+
+            namespace detail {
+                /*
+                 * B in point-value form over the powers of unity_root(n).
+                 */
+                template<typename Allocator, typename FieldValueType>
+                polynomial_dfs<FieldValueType, Allocator> sparse_to_dfs(const sparse_polynomial<FieldValueType> &B,
+                                                                        std::size_t n) {
+                    typedef typename FieldValueType::field_type FieldType;
+
+                    polynomial_dfs<FieldValueType, Allocator> result(B.degree(), n, FieldValueType::zero());
+                    sparse_evaluate_add(result.data(), n, unity_root<FieldType>(n), B.begin(), B.end());
+                    return result;
+                }
+            }    // namespace detail
+
+            /**
+             * Adds the terms of B to A, touching only the coefficients B has.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> &operator+=(polynomial<FieldValueType, Allocator> &A,
+                                                              const sparse_polynomial<FieldValueType> &B) {
+                if (B.degree() >= A.size()) {
+                    A.resize(B.degree() + 1, FieldValueType::zero());
+                }
+                for (const auto &t : B) {
+                    A[t.first] += t.second;
+                }
+                A.condense();
+                return A;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> &operator-=(polynomial<FieldValueType, Allocator> &A,
+                                                              const sparse_polynomial<FieldValueType> &B) {
+                if (B.degree() >= A.size()) {
+                    A.resize(B.degree() + 1, FieldValueType::zero());
+                }
+                for (const auto &t : B) {
+                    A[t.first] -= t.second;
+                }
+                A.condense();
+                return A;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator+(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                polynomial<FieldValueType, Allocator> result(A);
+                result += B;
+                return result;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator+(const sparse_polynomial<FieldValueType> &A,
+                                                            const polynomial<FieldValueType, Allocator> &B) {
+                return B + A;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator-(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                polynomial<FieldValueType, Allocator> result(A);
+                result -= B;
+                return result;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator-(const sparse_polynomial<FieldValueType> &A,
+                                                            const polynomial<FieldValueType, Allocator> &B) {
+                polynomial<FieldValueType, Allocator> result = -B;
+                result += A;
+                return result;
+            }
+
+            /**
+             * Product of a dense and a sparse polynomial in O(n * terms), see detail::sparse_multiply_add.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator*(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                if (A.is_zero() || B.is_zero()) {
+                    return polynomial<FieldValueType, Allocator>();
+                }
+                polynomial<FieldValueType, Allocator> result(A.size() + B.degree(), FieldValueType::zero());
+                detail::sparse_multiply_add(result.data(), result.size(), A.data(), A.size(), B.begin(), B.end());
+                result.condense();
+                return result;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator*(const sparse_polynomial<FieldValueType> &A,
+                                                            const polynomial<FieldValueType, Allocator> &B) {
+                return B * A;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> &operator*=(polynomial<FieldValueType, Allocator> &A,
+                                                              const sparse_polynomial<FieldValueType> &B) {
+                A = A * B;
+                return A;
+            }
+
+            /**
+             * Perform the Euclidean Division algorithm by a sparse divisor, in O(n * terms) by long division
+             * touching only the terms of b, or through detail::binomial_divide for b_d x^d + b_0.
+             * Input: Polynomial A, Sparse polynomial B, where A / B
+             * Output: Polynomial Q, Polynomial R, such that A = (Q * B) + R.
+             */
+            template<typename Range, typename FieldValueType>
+            void division(Range &q, Range &r, const Range &a, const sparse_polynomial<FieldValueType> &b) {
+                if (b.is_zero()) {
+                    throw std::invalid_argument("division by the zero polynomial");
+                }
+
+                typename detail::coefficient_buffer<Range>::type quotient(1, FieldValueType::zero());
+                typename detail::coefficient_buffer<Range>::type remainder(std::begin(a), std::end(a));
+                condense(remainder);
+
+                const std::size_t d = b.degree();
+                if (remainder.size() > d) {
+                    const FieldValueType lead_inverse = b.rbegin()->second.inversed();
+                    const std::size_t n = remainder.size();
+                    if (b.size() == 1 || (b.size() == 2 && b.begin()->first == 0)) {
+                        const FieldValueType c =
+                            b.size() == 1 ? FieldValueType::zero() : -b.begin()->second * lead_inverse;
+                        if (d > 0) {
+                            detail::binomial_divide(remainder.data(), n, d, c);
+                        }
+                        quotient.assign(remainder.begin() + d, remainder.end());
+                        if (lead_inverse != FieldValueType::one()) {
+                            for (FieldValueType &u : quotient) {
+                                u *= lead_inverse;
+                            }
+                        }
+                    } else {
+                        quotient.assign(n - d, FieldValueType::zero());
+                        for (std::size_t s = n; s-- > d;) {
+                            const FieldValueType lead_coeff = remainder[s] * lead_inverse;
+                            quotient[s - d] = lead_coeff;
+                            for (auto it = b.begin(); it->first < d; ++it) {
+                                remainder[s - d + it->first] -= lead_coeff * it->second;
+                            }
+                        }
+                    }
+                    remainder.resize(d);
+                }
+                if (remainder.empty()) {
+                    remainder.push_back(FieldValueType::zero());
+                }
+                condense(quotient);
+                condense(remainder);
+
+                detail::assign_coefficients(q, std::move(quotient));
+                detail::assign_coefficients(r, std::move(remainder));
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator/(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                polynomial<FieldValueType, Allocator> q, r;
+                division(q, r, A, B);
+                return q;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator%(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                polynomial<FieldValueType, Allocator> q, r;
+                division(q, r, A, B);
+                return r;
+            }
+
+            /**
+             * Adds B to A in point-value form, A is first resized if B does not fit its domain.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> &operator+=(polynomial_dfs<FieldValueType, Allocator> &A,
+                                                                  const sparse_polynomial<FieldValueType> &B) {
+                if (B.degree() >= A.size()) {
+                    A.resize(detail::power_of_two(B.degree() + 1));
+                }
+                A += detail::sparse_to_dfs<Allocator>(B, A.size());
+                return A;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> &operator-=(polynomial_dfs<FieldValueType, Allocator> &A,
+                                                                  const sparse_polynomial<FieldValueType> &B) {
+                A += -B;
+                return A;
+            }
+
+            /**
+             * Multiplies A by B in point-value form, A is first resized to hold the product.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> &operator*=(polynomial_dfs<FieldValueType, Allocator> &A,
+                                                                  const sparse_polynomial<FieldValueType> &B) {
+                const std::size_t n = detail::power_of_two(std::max(A.size(), A.degree() + B.degree() + 1));
+                if (A.size() < n) {
+                    A.resize(n);
+                }
+                A *= detail::sparse_to_dfs<Allocator>(B, n);
+                return A;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator+(const polynomial_dfs<FieldValueType, Allocator> &A,
+                                                                const sparse_polynomial<FieldValueType> &B) {
+                polynomial_dfs<FieldValueType, Allocator> result(A);
+                result += B;
+                return result;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator+(const sparse_polynomial<FieldValueType> &A,
+                                                                const polynomial_dfs<FieldValueType, Allocator> &B) {
+                return B + A;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator-(const polynomial_dfs<FieldValueType, Allocator> &A,
+                                                                const sparse_polynomial<FieldValueType> &B) {
+                polynomial_dfs<FieldValueType, Allocator> result(A);
+                result -= B;
+                return result;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator*(const polynomial_dfs<FieldValueType, Allocator> &A,
+                                                                const sparse_polynomial<FieldValueType> &B) {
+                polynomial_dfs<FieldValueType, Allocator> result(A);
+                result *= B;
+                return result;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator> operator*(const sparse_polynomial<FieldValueType> &A,
+                                                                const polynomial_dfs<FieldValueType, Allocator> &B) {
+                return B * A;
+            }
+
+            /**
+             * The vanishing polynomial of the domain, see evaluation_domain::get_vanishing_polynomial_terms.
+             */
+            template<typename FieldType>
+            sparse_polynomial<typename FieldType::value_type>
+                get_vanishing_polynomial(evaluation_domain<FieldType> &domain) {
+                const std::vector<std::pair<std::size_t, typename FieldType::value_type>> terms =
+                    domain.get_vanishing_polynomial_terms();
+                return sparse_polynomial<typename FieldType::value_type>(terms.begin(), terms.end());
+            }
+
+            /**
+             * Add coeff times the vanishing polynomial of the domain to the sparse polynomial H.
+             */
+            template<typename FieldType>
+            void add_poly_z(evaluation_domain<FieldType> &domain,
+                            const typename FieldType::value_type &coeff,
+                            sparse_polynomial<typename FieldType::value_type> &H) {
+                H += coeff * get_vanishing_polynomial(domain);
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_SPARSE_POLYNOMIAL_HPP
@@ -0,0 +1,267 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_SUBPRODUCT_TREE_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_SUBPRODUCT_TREE_HPP
+
+#include <algorithm>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <nil/crypto3/math/detail/precomputation.hpp>
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Subproduct tree of the points x_0, ..., x_{n-1}.
+             * Below we make use of the Subproduct Tree description from
+             * [Bostan and Schost 2005. Polynomial Evaluation and Interpolation on Special Sets of Points], on
+             * page 7.
+             *
+             * T_{i, j} = product_{l = [2^i * j] to [min(2^i * (j+1), n) - 1]} (x - x_l)
+             *
+             * Every node is monic, so only its low coefficients are stored. The nodes of a level cover disjoint
+             * point ranges, hence each level is a contiguous block of exactly n coefficients and node (i, j)
+             * lives at offset i * n + 2^i * j of a single buffer.
+             */
+            template<typename FieldType>
+            class subproduct_tree {
+                typedef typename FieldType::value_type value_type;
+
+            public:
+                typedef FieldType field_type;
+
+                subproduct_tree() : n(0), h(0) {
+                }
+
+                template<typename Range>
+                explicit subproduct_tree(const Range &points) {
+                    build(points);
+                }
+
+                /**
+                 * (Re)build the tree for the given points.
+                 */
+                template<typename Range>
+                void build(const Range &points) {
+                    n = std::distance(std::begin(points), std::end(points));
+                    h = 0;
+                    while ((std::size_t(1) << h) < n) {
+                        ++h;
+                    }
+
+                    std::vector<value_type> storage(n * (h + 1), value_type::zero());
+
+                    /* Precompute the first row: x - x_j */
+                    std::size_t leaf = 0;
+                    for (auto it = std::begin(points); it != std::end(points); ++it, ++leaf) {
+                        storage[leaf] = -value_type(*it);
+                    }
+
+                    for (std::size_t i = 1; i <= h; i++) {
+                        const std::size_t count = nodes(i);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                        for (std::size_t j = 0; j < count; j++) {
+                            compute_node(storage.data(), i, j);
+                        }
+                    }
+
+                    arena = std::move(storage);
+                }
+
+                /**
+                 * Adopt the nodes of a tree on n points, as laid out by storage(), e.g. from a precomputation file.
+                 */
+                void assign(std::size_t n, const detail::precomputed_table<value_type> &nodes) {
+                    std::size_t depth = 0;
+                    while ((std::size_t(1) << depth) < n) {
+                        ++depth;
+                    }
+                    if (nodes.size() != n * (depth + 1)) {
+                        throw std::invalid_argument("subproduct_tree: expected n * (depth + 1) coefficients");
+                    }
+
+                    this->n = n;
+                    this->h = depth;
+                    arena = nodes;
+                }
+
+                /**
+                 * All the levels of the tree, level i at offset i * size().
+                 */
+                const detail::precomputed_table<value_type> &storage() const {
+                    return arena;
+                }
+
+                /**
+                 * Number of points.
+                 */
+                std::size_t size() const {
+                    return n;
+                }
+
+                /**
+                 * Level of the root node.
+                 */
+                std::size_t depth() const {
+                    return h;
+                }
+
+                /**
+                 * Number of nodes on the level.
+                 */
+                std::size_t nodes(std::size_t level) const {
+                    return (n + (std::size_t(1) << level) - 1) >> level;
+                }
+
+                std::size_t node_degree(std::size_t level, std::size_t j) const {
+                    return std::min((j + 1) << level, n) - (j << level);
+                }
+
+                /**
+                 * Low coefficients of node (level, j), the leading one is implicit.
+                 */
+                const value_type *node_data(std::size_t level, std::size_t j) const {
+                    return arena.data() + level * n + (j << level);
+                }
+
+                /**
+                 * Coefficients of node (level, j), including the leading one.
+                 */
+                std::vector<value_type> node(std::size_t level, std::size_t j) const {
+                    const value_type *first = node_data(level, j);
+
+                    std::vector<value_type> result(first, first + node_degree(level, j));
+                    result.emplace_back(value_type::one());
+                    return result;
+                }
+
+                /**
+                 * The vanishing polynomial of all the points.
+                 */
+                std::vector<value_type> root() const {
+                    return node(h, 0);
+                }
+
+                value_type point(std::size_t j) const {
+                    return -arena[j];
+                }
+
+                /**
+                 * Compute sum_i c_i * prod_{j != i} (x - x_j) bottom up, where the combination for node (i, j) is
+                 * r_{i, j} = r_{i-1, 2j} * T_{i-1, 2j+1} + r_{i-1, 2j+1} * T_{i-1, 2j}.
+                 * Below we make use of the linear combination from
+                 * [Gathen and Gerhard, Modern Computer Algebra 3rd Ed., Algorithm 10.9].
+                 */
+                template<typename Range>
+                std::vector<value_type> linear_combination(const Range &c) const {
+                    std::vector<value_type> current(std::begin(c), std::end(c));
+                    std::vector<value_type> next(n, value_type::zero());
+                    current.resize(n, value_type::zero());
+
+                    for (std::size_t i = 1; i <= h; i++) {
+                        const std::size_t count = nodes(i);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                        for (std::size_t j = 0; j < count; j++) {
+                            value_type *out = next.data() + (j << i);
+                            const value_type *r_l = current.data() + ((2 * j) << (i - 1));
+                            const std::size_t d_l = node_degree(i - 1, 2 * j);
+
+                            if (2 * j + 1 >= nodes(i - 1)) {
+                                std::copy(r_l, r_l + d_l, out);
+                                continue;
+                            }
+
+                            const value_type *r_r = current.data() + ((2 * j + 1) << (i - 1));
+                            const std::size_t d_r = node_degree(i - 1, 2 * j + 1);
+
+                            std::fill(out, out + d_l + d_r, value_type::zero());
+                            detail::multiply_add(out, r_l, d_l, node_data(i - 1, 2 * j + 1), d_r);
+                            detail::multiply_add(out, r_r, d_r, node_data(i - 1, 2 * j), d_l);
+
+                            for (std::size_t t = 0; t < d_l; t++) {
+                                out[d_r + t] += r_l[t];
+                            }
+                            for (std::size_t t = 0; t < d_r; t++) {
+                                out[d_l + t] += r_r[t];
+                            }
+                        }
+
+                        current.swap(next);
+                    }
+
+                    return current;
+                }
+
+            private:
+                /*
+                 * With monic children x^{d_l} + l(x) and x^{d_r} + r(x) the low part of the product is
+                 * l * r + x^{d_l} * r + x^{d_r} * l.
+                 */
+                void compute_node(value_type *base, std::size_t i, std::size_t j) const {
+                    value_type *out = base + i * n + (j << i);
+                    const value_type *l = base + (i - 1) * n + ((2 * j) << (i - 1));
+                    const std::size_t d_l = node_degree(i - 1, 2 * j);
+
+                    if (2 * j + 1 >= nodes(i - 1)) {
+                        std::copy(l, l + d_l, out);
+                        return;
+                    }
+
+                    const value_type *r = l + (std::size_t(1) << (i - 1));
+                    const std::size_t d_r = node_degree(i - 1, 2 * j + 1);
+
+                    std::fill(out, out + d_l + d_r, value_type::zero());
+                    detail::multiply_add(out, l, d_l, r, d_r);
+
+                    for (std::size_t t = 0; t < d_r; t++) {
+                        out[d_l + t] += r[t];
+                    }
+                    for (std::size_t k = 0; k < d_l; k++) {
+                        out[d_r + k] += l[k];
+                    }
+                }
+
+                std::size_t n;
+                std::size_t h;
+                detail::precomputed_table<value_type> arena;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_SUBPRODUCT_TREE_HPP
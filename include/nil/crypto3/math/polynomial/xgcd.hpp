@@ -32,14 +32,143 @@
 #include <boost/math/tools/polynomial_gcd.hpp>
 #include <boost/integer/extended_euclidean.hpp>
 
+#include <nil/crypto3/math/detail/arena.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
 
+            namespace detail {
+                /*
+                 * Remainders of degree below half_gcd_threshold are reduced by plain Euclidean steps.
+                 */
+                constexpr std::size_t half_gcd_threshold = 128;
+
+                /*
+                 * Degree of a condensed polynomial, -1 for the zero polynomial.
+                 */
+                template<typename ValueType>
+                std::ptrdiff_t euclidean_degree(const scratch_vector<ValueType> &p) {
+                    return is_zero(p) ? -1 : std::ptrdiff_t(p.size()) - 1;
+                }
+
+                /*
+                 * p div x^k
+                 */
+                template<typename ValueType>
+                scratch_vector<ValueType> shift_down(const scratch_vector<ValueType> &p, std::size_t k) {
+                    if (k >= p.size()) {
+                        return scratch_vector<ValueType>(1, ValueType::zero());
+                    }
+                    return scratch_vector<ValueType>(p.begin() + k, p.end());
+                }
+
+                /*
+                 * A 2x2 polynomial matrix mapping (A, B) to (u0 * A + v0 * B, u1 * A + v1 * B), the product of the
+                 * Euclidean steps (A, B) -> (B, A - q * B) taken so far.
+                 */
+                template<typename ValueType>
+                struct euclidean_transform {
+                    typedef scratch_vector<ValueType> polynomial_type;
+
+                    polynomial_type u0 = polynomial_type(1, ValueType::one());
+                    polynomial_type v0 = polynomial_type(1, ValueType::zero());
+                    polynomial_type u1 = polynomial_type(1, ValueType::zero());
+                    polynomial_type v1 = polynomial_type(1, ValueType::one());
+
+                    static polynomial_type dot(const polynomial_type &x0,
+                                               const polynomial_type &y0,
+                                               const polynomial_type &x1,
+                                               const polynomial_type &y1) {
+                        polynomial_type s, t;
+                        multiplication(s, x0, y0);
+                        multiplication(t, x1, y1);
+                        addition(s, s, t);
+                        return s;
+                    }
+
+                    void apply(polynomial_type &a, polynomial_type &b) const {
+                        polynomial_type c = dot(u0, a, v0, b);
+                        b = dot(u1, a, v1, b);
+                        a.swap(c);
+                    }
+
+                    /* Append the step with quotient q */
+                    void step(const polynomial_type &q) {
+                        polynomial_type t;
+                        multiplication(t, q, u1);
+                        subtraction(u0, u0, t);
+                        multiplication(t, q, v1);
+                        subtraction(v0, v0, t);
+                        u0.swap(u1);
+                        v0.swap(v1);
+                    }
+
+                    /* Append the steps of later */
+                    void compose(const euclidean_transform &later) {
+                        polynomial_type r_u0 = dot(later.u0, u0, later.v0, u1);
+                        polynomial_type r_v0 = dot(later.u0, v0, later.v0, v1);
+                        polynomial_type r_u1 = dot(later.u1, u0, later.v1, u1);
+                        v1 = dot(later.u1, v0, later.v1, v1);
+                        u0.swap(r_u0);
+                        v0.swap(r_v0);
+                        u1.swap(r_u1);
+                    }
+                };
+
+                /*
+                 * Take one Euclidean step on (a, b), recording its quotient in t.
+                 */
+                template<typename ValueType>
+                void euclidean_step(scratch_vector<ValueType> &a, scratch_vector<ValueType> &b,
+                                    euclidean_transform<ValueType> &t) {
+                    scratch_vector<ValueType> q, r;
+                    division(q, r, a, b);
+                    t.step(q);
+                    a.swap(b);
+                    b.swap(r);
+                }
+
+                /*
+                 * Knuth-Schoenhage half-GCD for deg(a) >= deg(b): the steps of the Euclidean algorithm on (a, b)
+                 * up to the first remainder of degree below ceil(deg(a) / 2). They only depend on the leading
+                 * halves of a and b, which the two recursive calls work on.
+                 */
+                template<typename ValueType>
+                euclidean_transform<ValueType> half_gcd(const scratch_vector<ValueType> &a,
+                                                        const scratch_vector<ValueType> &b) {
+                    const std::ptrdiff_t m = (euclidean_degree(a) + 1) / 2;
+
+                    euclidean_transform<ValueType> t;
+                    if (euclidean_degree(b) < m) {
+                        return t;
+                    }
+
+                    scratch_vector<ValueType> x(a), y(b);
+                    if (euclidean_degree(a) < std::ptrdiff_t(half_gcd_threshold)) {
+                        while (euclidean_degree(y) >= m) {
+                            euclidean_step(x, y, t);
+                        }
+                        return t;
+                    }
+
+                    t = half_gcd(shift_down(a, m), shift_down(b, m));
+                    t.apply(x, y);
+                    if (euclidean_degree(y) < m) {
+                        return t;
+                    }
+
+                    euclidean_step(x, y, t);
+                    const std::size_t k = 2 * m - euclidean_degree(x);
+                    t.compose(half_gcd(shift_down(x, k), shift_down(y, k)));
+                    return t;
+                }
+            }    // namespace detail
+
             /*!
-             * @brief Perform the standard Extended Euclidean Division algorithm.
+             * @brief Perform the Extended Euclidean Division algorithm. Remainders of high degree are reduced
+             * through the half-GCD in O(M(n) log n), the last steps are taken one by one.
              * Input: Polynomial A, Polynomial B.
              * Output: Polynomial G, Polynomial U, Polynomial V, such that G = (A * U) + (B * V).
              */
@@ -57,41 +186,38 @@ namespace nil {
                     return;
                 }
 
-                std::vector<value_type> U(1, value_type::one());
-                std::vector<value_type> V1(1, value_type::zero());
-                std::vector<value_type> G(a);
-                std::vector<value_type> V3(b);
-
-                std::vector<value_type> Q(1, value_type::zero());
-                std::vector<value_type> R(1, value_type::zero());
-                std::vector<value_type> T(1, value_type::zero());
+                detail::scratch_vector<value_type> G(std::begin(a), std::end(a));
+                detail::scratch_vector<value_type> V3(std::begin(b), std::end(b));
+                condense(G);
+                condense(V3);
 
+                detail::euclidean_transform<value_type> t;
+                if (detail::euclidean_degree(G) < detail::euclidean_degree(V3)) {
+                    detail::euclidean_step(G, V3, t);
+                }
                 while (!is_zero(V3)) {
-                    division(Q, R, G, V3);
-                    multiplication(G, V1, Q);
-                    subtraction(T, U, G);
-
-                    U = V1;
-                    G = V3;
-                    V1 = T;
-                    V3 = R;
+                    if (detail::euclidean_degree(G) >= std::ptrdiff_t(detail::half_gcd_threshold)) {
+                        const detail::euclidean_transform<value_type> h = detail::half_gcd(G, V3);
+                        h.apply(G, V3);
+                        t.compose(h);
+                        if (is_zero(V3)) {
+                            break;
+                        }
+                    }
+                    detail::euclidean_step(G, V3, t);
                 }
 
-                multiplication(V3, a, U);
-                subtraction(V3, G, V3);
-                division(V1, R, V3, b);
-
                 value_type lead_coeff = G.back().inversed();
                 std::transform(G.begin(), G.end(), G.begin(),
                                std::bind(std::multiplies<value_type>(), lead_coeff, std::placeholders::_1));
-                std::transform(U.begin(), U.end(), U.begin(),
+                std::transform(t.u0.begin(), t.u0.end(), t.u0.begin(),
                                std::bind(std::multiplies<value_type>(), lead_coeff, std::placeholders::_1));
-                std::transform(V1.begin(), V1.end(), V1.begin(),
+                std::transform(t.v0.begin(), t.v0.end(), t.v0.begin(),
                                std::bind(std::multiplies<value_type>(), lead_coeff, std::placeholders::_1));
 
-                g = G;
-                u = U;
-                v = V1;
+                g = Range3(G.begin(), G.end());
+                u = Range4(t.u0.begin(), t.u0.end());
+                v = Range5(t.v0.begin(), t.v0.end());
             }
         }    // namespace math
     }        // namespace crypto3
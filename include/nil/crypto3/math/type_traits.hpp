@@ -62,12 +62,10 @@ namespace nil {
                 template<typename FieldType>
                 bool is_extended_radix2_domain(std::size_t m) {
                     const std::size_t log_m = static_cast<std::size_t>(std::ceil(std::log2(m)));
-                    const std::size_t small_m = m / 2;
-                    const std::size_t log_small_m = static_cast<std::size_t>(std::ceil(std::log2(small_m)));
 
-                    return (m > 1) && (log_m == fields::arithmetic_params<FieldType>::s + 1) &&
-                           (small_m == (1ul << log_small_m)) &&
-                           (log_small_m <= fields::arithmetic_params<FieldType>::s);
+                    return (m > 1) && (m == (1ul << log_m)) && (log_m > fields::arithmetic_params<FieldType>::s) &&
+                           (log_m - fields::arithmetic_params<FieldType>::s <=
+                            extended_radix2_domain<FieldType>::max_cosets_log);
                 }
 
                 template<typename FieldType>
@@ -27,9 +27,15 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <initializer_list>
 #include <memory>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <cstdint>
+#include <cstdio>
+#include <string>
 
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
 #include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
@@ -53,6 +59,7 @@
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
 #include <nil/crypto3/math/polynomial/evaluate.hpp>
+#include <nil/crypto3/math/polynomial/sparse_polynomial.hpp>
 
 #include <typeinfo>
 
@@ -171,6 +178,95 @@ void test_lagrange_coefficients() {
     }
 }
 
+template<typename FieldType>
+void test_extended_radix2_cosets() {
+    typedef typename FieldType::value_type value_type;
+
+    const value_type t = value_type(10);
+    const value_type coeff = value_type(3);
+    const value_type coset = value_type(fields::arithmetic_params<FieldType>::multiplicative_generator);
+
+    /* m = 2^(s + k) is covered by 2^k cosets of the largest 2-adic subgroup; k = 1 is the classic case */
+    for (std::size_t k : {2, 3}) {
+        const std::size_t m = std::size_t(1) << (fields::arithmetic_params<FieldType>::s + k);
+        extended_radix2_domain<FieldType> domain(m);
+        BOOST_CHECK_EQUAL(domain.cosets, std::size_t(1) << k);
+
+        std::vector<value_type> d(m), f(m);
+        for (std::size_t i = 0; i < m; i++) {
+            d[i] = domain.get_domain_element(i);
+            f[i] = value_type(3 * i * i + 2 * k + 1);
+        }
+
+        std::vector<value_type> a(f);
+        domain.fft(a);
+        for (std::size_t i = 0; i < m; i++) {
+            BOOST_CHECK_EQUAL(evaluate_polynomial(f, d[i], m).data, a[i].data);
+        }
+        domain.inverse_fft(a);
+        BOOST_CHECK(a == f);
+
+        multiply_by_coset(a, coset);
+        domain.fft(a);
+        domain.inverse_fft(a);
+        multiply_by_coset(a, coset.inversed());
+        BOOST_CHECK(a == f);
+
+        value_type Z = value_type::one();
+        for (std::size_t i = 0; i < m; i++) {
+            Z *= t - d[i];
+            BOOST_CHECK(domain.compute_vanishing_polynomial(d[i]).is_zero());
+        }
+        BOOST_CHECK_EQUAL(Z.data, domain.compute_vanishing_polynomial(t).data);
+
+        std::vector<value_type> H(m + 1, value_type::zero());
+        domain.add_poly_z(coeff, H);
+        BOOST_CHECK_EQUAL(evaluate_polynomial(H, t, m + 1).data, (coeff * Z).data);
+        BOOST_CHECK_EQUAL(get_vanishing_polynomial(domain).evaluate(t).data, Z.data);
+
+        const std::vector<value_type> L = domain.evaluate_all_lagrange_polynomials(t);
+        for (std::size_t i = 0; i < m; i++) {
+            BOOST_CHECK_EQUAL(evaluate_lagrange_polynomial(d, t, m, i).data, L[i].data);
+        }
+
+        const std::size_t j = m / 2 + 1;
+        const std::vector<value_type> delta = domain.evaluate_all_lagrange_polynomials(d[j]);
+        for (std::size_t i = 0; i < m; i++) {
+            BOOST_CHECK(delta[i] == (i == j ? value_type::one() : value_type::zero()));
+        }
+    }
+}
+
+template<typename FieldType>
+void test_step_radix2_above_task_grain() {
+    typedef typename FieldType::value_type value_type;
+
+    /* Both halves are larger than the grain, so under MULTICORE each splits into tasks */
+    const std::size_t small_m = 2 * detail::radix2_task_grain;
+    const std::size_t m = 2 * small_m + small_m;
+    step_radix2_domain<FieldType> domain(m);
+    BOOST_CHECK_EQUAL(domain.small_m, small_m);
+
+    std::vector<value_type> f(m);
+    for (std::size_t i = 0; i < m; i++) {
+        f[i] = value_type(i * i + 7 * i + 3);
+    }
+
+    std::vector<value_type> a(f);
+    domain.fft(a);
+    for (std::size_t i : {std::size_t(0), std::size_t(1), domain.big_m - 1, domain.big_m, m - 1}) {
+        BOOST_CHECK_EQUAL(evaluate_polynomial(f, domain.get_domain_element(i), m).data, a[i].data);
+    }
+    domain.inverse_fft(a);
+    BOOST_CHECK(a == f);
+
+    std::vector<value_type> b(f.begin(), f.begin() + 2 * small_m), c(b);
+    const value_type omega = unity_root<FieldType>(b.size());
+    detail::basic_task_radix2_fft<FieldType>(b, omega);
+    detail::basic_serial_radix2_fft<FieldType>(c, omega);
+    BOOST_CHECK(b == c);
+}
+
 template<typename FieldType>
 void test_compute_z() {
     typedef typename FieldType::value_type value_type;
@@ -194,6 +290,359 @@ void test_compute_z() {
     BOOST_CHECK_EQUAL(Z.data, a.data);
 }
 
+template<typename FieldType>
+void test_vanishing_polynomial() {
+    typedef typename FieldType::value_type value_type;
+
+    const std::size_t m = 8;
+    const value_type t = value_type(10);
+    const value_type coeff = value_type(3);
+
+    std::vector<std::shared_ptr<evaluation_domain<FieldType>>> domains = {
+        std::make_shared<basic_radix2_domain<FieldType>>(m),
+        std::make_shared<step_radix2_domain<FieldType>>(m + 4),
+        std::make_shared<step_radix2_domain<FieldType>>(2 * m),
+        std::make_shared<arithmetic_sequence_domain<FieldType>>(m),
+        std::make_shared<geometric_sequence_domain<FieldType>>(m),
+        std::make_shared<geometric_sequence_domain<FieldType>>(m + 5)};
+    for (const auto &domain : domains) {
+        const value_type z_t = domain->compute_vanishing_polynomial(t);
+
+        const sparse_polynomial<value_type> z = get_vanishing_polynomial(*domain);
+        BOOST_CHECK_EQUAL(z.degree(), domain->m);
+        BOOST_CHECK_EQUAL(z.evaluate(t).data, z_t.data);
+
+        /* The dense default, as an out-of-tree domain would get it, agrees with every override */
+        BOOST_CHECK(domain->get_vanishing_polynomial_terms() ==
+                    domain->evaluation_domain<FieldType>::get_vanishing_polynomial_terms());
+
+        std::vector<value_type> dense(domain->m + 1, value_type::zero());
+        domain->add_poly_z(value_type::one(), dense);
+        BOOST_CHECK_EQUAL(evaluate_polynomial(dense, t, domain->m + 1).data, z_t.data);
+
+        sparse_polynomial<value_type> H(value_type::one(), 1);
+        add_poly_z(*domain, coeff, H);
+        BOOST_CHECK_EQUAL(H.evaluate(t).data, (t + coeff * z_t).data);
+    }
+}
+
+template<typename FieldType>
+void test_geometric_repeated_fft() {
+    typedef typename FieldType::value_type value_type;
+
+    const std::size_t m = 12;
+    geometric_sequence_domain<FieldType> domain(m);
+
+    /* The cached kernels and FFT images are reused by every call, so none of them may be consumed by the first */
+    for (std::size_t round = 0; round < 3; round++) {
+        std::vector<value_type> f(m);
+        for (std::size_t i = 0; i < m; i++) {
+            f[i] = value_type(5 * i * i + 7 * round + 1);
+        }
+
+        std::vector<value_type> a(f);
+        domain.fft(a);
+        std::vector<value_type> e(m);
+        for (std::size_t i = 0; i < m; i++) {
+            e[i] = evaluate_polynomial(f, domain.get_domain_element(i), m);
+            BOOST_CHECK_EQUAL(e[i].data, a[i].data);
+        }
+
+        domain.inverse_fft(a);
+        domain.inverse_fft(e);
+        for (std::size_t i = 0; i < m; i++) {
+            BOOST_CHECK_EQUAL(f[i].data, a[i].data);
+            BOOST_CHECK_EQUAL(f[i].data, e[i].data);
+        }
+    }
+}
+
+template<typename FieldType>
+void test_precomputation_element() {
+    typedef typename FieldType::value_type value_type;
+    typedef detail::precomputation_element<value_type> element;
+
+    /* Elements are stored as the limbs of their integral representation, least significant first */
+    std::uint64_t limbs[element::limbs];
+    element::write(value_type::one(), limbs);
+    BOOST_CHECK_EQUAL(limbs[0], 1);
+    for (std::size_t i = 1; i < element::limbs; i++) {
+        BOOST_CHECK_EQUAL(limbs[i], 0);
+    }
+
+    const value_type generator = value_type(fields::arithmetic_params<FieldType>::multiplicative_generator);
+    for (const value_type &value : {value_type::zero(), -value_type::one(), generator, generator.inversed()}) {
+        element::write(value, limbs);
+        BOOST_CHECK(element::read(limbs) == value);
+    }
+}
+
+/*
+ * Copy the precomputation file at path to truncated_path with the last value of one table dropped.
+ */
+template<typename ValueType>
+void write_truncated_precomputation(const std::string &path, const std::string &truncated_path, std::size_t table) {
+    const detail::precomputation_file file(path);
+
+    std::vector<detail::precomputed_table<ValueType>> tables;
+    for (std::size_t i = 0; i < file.tables(); i++) {
+        tables.push_back(file.table<ValueType>(i));
+    }
+    tables[table] = std::vector<ValueType>(tables[table].begin(), tables[table].end() - 1);
+
+    detail::write_precomputation(truncated_path, file.kind(), file.size(), file.fingerprint(), tables);
+}
+
+template<typename FieldType>
+void test_geometric_precomputation() {
+    typedef typename FieldType::value_type value_type;
+
+    const std::size_t m = 16;
+    const std::string path = "geometric_sequence_domain_precomputation.bin";
+
+    geometric_sequence_domain<FieldType> computed(m);
+    computed.save_precomputation(path);
+
+    geometric_sequence_domain<FieldType> loaded(m);
+    loaded.load_precomputation(path);
+
+    std::vector<value_type> a(m);
+    for (std::size_t i = 0; i < m; i++) {
+        a[i] = value_type(3 * i * i + 1);
+    }
+    const std::vector<value_type> f(a);
+    std::vector<value_type> b(a);
+
+    computed.fft(a);
+    loaded.fft(b);
+    for (std::size_t i = 0; i < m; i++) {
+        BOOST_CHECK_EQUAL(a[i].data, b[i].data);
+        BOOST_CHECK_EQUAL(computed.get_domain_element(i).data, loaded.get_domain_element(i).data);
+    }
+
+    /* The vanishing polynomial is not stored, a loaded domain computes it on first use */
+    BOOST_CHECK_EQUAL(detail::precomputation_file(path).tables(), 14);
+    BOOST_CHECK(loaded.get_vanishing_polynomial_terms() == computed.get_vanishing_polynomial_terms());
+
+    geometric_sequence_domain<FieldType> other(m / 2);
+    BOOST_CHECK_THROW(other.load_precomputation(path), std::invalid_argument);
+
+    /* Threads may already read the tables of a precomputed domain without the lock */
+    BOOST_CHECK_THROW(loaded.load_precomputation(path), std::invalid_argument);
+    BOOST_CHECK_THROW(computed.load_precomputation(path), std::invalid_argument);
+
+    /* A short table of either length is refused and leaves the domain untouched */
+    const std::string truncated_path = "geometric_sequence_domain_truncated.bin";
+    for (std::size_t table : {0, 9, 13}) {
+        write_truncated_precomputation<value_type>(path, truncated_path, table);
+
+        geometric_sequence_domain<FieldType> truncated(m);
+        BOOST_CHECK_THROW(truncated.load_precomputation(truncated_path), std::invalid_argument);
+        truncated.load_precomputation(path);
+
+        std::vector<value_type> c(f);
+        truncated.fft(c);
+        BOOST_CHECK(c == a);
+    }
+
+    std::remove(truncated_path.c_str());
+    std::remove(path.c_str());
+}
+
+template<typename FieldType>
+void test_arithmetic_domain_sizes() {
+    typedef typename FieldType::value_type value_type;
+
+    /* The basis changes walk a subproduct tree on 2^log2(m) points, so other sizes are refused */
+    BOOST_CHECK_THROW(arithmetic_sequence_domain<FieldType>(12), std::invalid_argument);
+    for (const evaluation_domain_candidate &candidate : evaluation_domain_candidates<FieldType>(12)) {
+        BOOST_CHECK(candidate.kind != evaluation_domain_kind::arithmetic_sequence);
+    }
+
+    const std::size_t m = 16;
+    arithmetic_sequence_domain<FieldType> domain(m);
+
+    std::vector<value_type> f(m);
+    for (std::size_t i = 0; i < m; i++) {
+        f[i] = value_type(i * i + 4);
+    }
+    std::vector<value_type> a(f);
+    domain.fft(a);
+    for (std::size_t i = 0; i < m; i++) {
+        BOOST_CHECK_EQUAL(evaluate_polynomial(f, domain.get_domain_element(i), m).data, a[i].data);
+    }
+    domain.inverse_fft(a);
+    BOOST_CHECK(a == f);
+}
+
+template<typename FieldType>
+void test_arithmetic_precomputation() {
+    typedef typename FieldType::value_type value_type;
+
+    const std::size_t m = 16;
+    const std::string path = "arithmetic_sequence_domain_precomputation.bin";
+    const std::string truncated_path = "arithmetic_sequence_domain_truncated.bin";
+
+    arithmetic_sequence_domain<FieldType> computed(m);
+    computed.save_precomputation(path);
+    BOOST_CHECK_THROW(computed.load_precomputation(path), std::invalid_argument);
+
+    for (std::size_t table : {0, 1}) {
+        write_truncated_precomputation<value_type>(path, truncated_path, table);
+
+        arithmetic_sequence_domain<FieldType> truncated(m);
+        BOOST_CHECK_THROW(truncated.load_precomputation(truncated_path), std::invalid_argument);
+    }
+
+    arithmetic_sequence_domain<FieldType> loaded(m);
+    loaded.load_precomputation(path);
+    BOOST_CHECK_THROW(loaded.load_precomputation(path), std::invalid_argument);
+
+    std::vector<value_type> a(m);
+    for (std::size_t i = 0; i < m; i++) {
+        a[i] = value_type(2 * i * i + 5);
+    }
+    std::vector<value_type> b(a);
+
+    computed.fft(a);
+    loaded.fft(b);
+    BOOST_CHECK(a == b);
+
+    BOOST_CHECK_EQUAL(detail::precomputation_file(path).tables(), 2);
+    BOOST_CHECK(loaded.get_vanishing_polynomial_terms() == computed.get_vanishing_polynomial_terms());
+
+    std::remove(truncated_path.c_str());
+    std::remove(path.c_str());
+}
+
+template<template<typename> class Domain, typename FieldType>
+void test_concurrent_first_use(std::size_t m) {
+    typedef typename FieldType::value_type value_type;
+    typedef Domain<FieldType> DomainType;
+
+    const std::size_t threads = 8;
+
+    std::vector<std::vector<value_type>> inputs(threads, std::vector<value_type>(m));
+    for (std::size_t t = 0; t < threads; t++) {
+        for (std::size_t i = 0; i < m; i++) {
+            inputs[t][i] = value_type(7 * t * i + i * i + 1);
+        }
+    }
+
+    DomainType serial(m);
+    std::vector<std::vector<value_type>> expected(inputs);
+    for (std::vector<value_type> &a : expected) {
+        serial.fft(a);
+    }
+
+    /* Every thread hits the lazy precomputations of the same fresh domain at once, odd ones vanishing first */
+    DomainType shared(m);
+    std::vector<std::vector<value_type>> evaluations(inputs), coefficients(threads);
+    std::vector<std::vector<std::pair<std::size_t, value_type>>> vanishing(threads);
+    std::atomic<bool> start(false);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            while (!start.load(std::memory_order_acquire)) {
+            }
+            if (t % 2 == 1) {
+                vanishing[t] = shared.get_vanishing_polynomial_terms();
+            }
+            shared.fft(evaluations[t]);
+            coefficients[t] = evaluations[t];
+            shared.inverse_fft(coefficients[t]);
+            if (t % 2 == 0) {
+                vanishing[t] = shared.get_vanishing_polynomial_terms();
+            }
+        });
+    }
+    start.store(true, std::memory_order_release);
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    for (std::size_t t = 0; t < threads; t++) {
+        BOOST_CHECK(evaluations[t] == expected[t]);
+        BOOST_CHECK(coefficients[t] == inputs[t]);
+        BOOST_CHECK(vanishing[t] == serial.get_vanishing_polynomial_terms());
+    }
+}
+
+template<typename FieldType>
+bool is_domain_of_kind(const evaluation_domain<FieldType> &domain, evaluation_domain_kind kind) {
+    switch (kind) {
+        case evaluation_domain_kind::basic_radix2:
+            return dynamic_cast<const basic_radix2_domain<FieldType> *>(&domain) != nullptr;
+        case evaluation_domain_kind::extended_radix2:
+            return dynamic_cast<const extended_radix2_domain<FieldType> *>(&domain) != nullptr;
+        case evaluation_domain_kind::step_radix2:
+            return dynamic_cast<const step_radix2_domain<FieldType> *>(&domain) != nullptr;
+        case evaluation_domain_kind::geometric_sequence:
+            return dynamic_cast<const geometric_sequence_domain<FieldType> *>(&domain) != nullptr;
+        case evaluation_domain_kind::arithmetic_sequence:
+            return dynamic_cast<const arithmetic_sequence_domain<FieldType> *>(&domain) != nullptr;
+    }
+    return false;
+}
+
+template<typename FieldType>
+void test_domain_choice(std::initializer_list<std::size_t> sizes) {
+    typedef typename FieldType::value_type value_type;
+
+    for (std::size_t m : sizes) {
+        const std::vector<evaluation_domain_candidate> candidates = evaluation_domain_candidates<FieldType>(m);
+        BOOST_CHECK(!candidates.empty());
+        if (candidates.empty()) {
+            continue;
+        }
+        for (std::size_t i = 0; i < candidates.size(); i++) {
+            BOOST_CHECK(candidates[i].size >= m);
+            if (i > 0) {
+                BOOST_CHECK(candidates[i - 1].cost <= candidates[i].cost);
+            }
+        }
+
+        std::shared_ptr<evaluation_domain<FieldType>> domain = make_evaluation_domain<FieldType>(m);
+        BOOST_CHECK(domain != nullptr);
+        if (domain == nullptr) {
+            continue;
+        }
+        BOOST_CHECK_EQUAL(domain->m, candidates.front().size);
+        BOOST_CHECK(is_domain_of_kind(*domain, candidates.front().kind));
+
+        /* The report names the chosen domain first and then every other candidate */
+        const std::string explanation = explain_domain_choice<FieldType>(m);
+        BOOST_CHECK(explanation.find("evaluation domain for m = " + std::to_string(m) + ":") == 0);
+        BOOST_CHECK(explanation.find("\n  * " + std::string(evaluation_domain_name(candidates.front().kind)) +
+                                     " size = " + std::to_string(candidates.front().size) + " ") !=
+                    std::string::npos);
+        for (const evaluation_domain_candidate &candidate : candidates) {
+            BOOST_CHECK(explanation.find(std::string(evaluation_domain_name(candidate.kind)) + " size = " +
+                                         std::to_string(candidate.size)) != std::string::npos);
+        }
+        BOOST_CHECK(explanation.find("no feasible domain") == std::string::npos);
+
+        std::vector<value_type> f(domain->m);
+        for (std::size_t i = 0; i < domain->m; i++) {
+            f[i] = value_type(i + 3);
+        }
+        std::vector<value_type> a(f);
+        domain->fft(a);
+        domain->inverse_fft(a);
+        for (std::size_t i = 0; i < domain->m; i++) {
+            BOOST_CHECK_EQUAL(f[i].data, a[i].data);
+        }
+    }
+}
+
+template<typename FieldType>
+void test_no_domain_choice(std::size_t m) {
+    BOOST_CHECK(evaluation_domain_candidates<FieldType>(m).empty());
+    BOOST_CHECK(make_evaluation_domain<FieldType>(m) == nullptr);
+    BOOST_CHECK_EQUAL(explain_domain_choice<FieldType>(m),
+                      "evaluation domain for m = " + std::to_string(m) + ": no feasible domain");
+}
+
 BOOST_AUTO_TEST_SUITE(fft_evaluation_domain_test_suite)
 
 BOOST_AUTO_TEST_CASE(fft) {
@@ -216,9 +665,62 @@ BOOST_AUTO_TEST_CASE(lagrange_coefficients) {
     test_lagrange_coefficients<fields::mnt4<298>>();
 }
 
+BOOST_AUTO_TEST_CASE(extended_radix2_cosets) {
+    /* The base field of BLS12-381 has 2-adicity 1, which keeps these domains small */
+    test_extended_radix2_cosets<fields::bls12<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(step_radix2_above_task_grain) {
+    test_step_radix2_above_task_grain<fields::bls12_fr<381>>();
+}
+
 BOOST_AUTO_TEST_CASE(compute_z) {
     test_compute_z<fields::bls12<381>>();
     test_compute_z<fields::mnt4<298>>();
 }
 
+BOOST_AUTO_TEST_CASE(vanishing_polynomial) {
+    test_vanishing_polynomial<fields::bls12_fr<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_first_use) {
+    test_concurrent_first_use<geometric_sequence_domain, fields::bls12_fr<381>>(24);
+    test_concurrent_first_use<arithmetic_sequence_domain, fields::bls12_fr<381>>(16);
+}
+
+BOOST_AUTO_TEST_CASE(domain_choice) {
+    test_domain_choice<fields::bls12_fr<381>>({2, 5, 7, 12, 16, 33, 100});
+    test_domain_choice<fields::mnt4<298>>({2, 5, 7, 12, 33, 100});
+
+    /* bls12<381> has 2-adicity 1: every domain but a power of two up to 2^(1 + max_cosets_log) is infeasible */
+    test_domain_choice<fields::bls12<381>>({2, 5, 7, 12, 33});
+    BOOST_CHECK(is_domain_of_kind(*make_evaluation_domain<fields::bls12<381>>(12),
+                                  evaluation_domain_kind::extended_radix2));
+    test_no_domain_choice<fields::bls12<381>>(100);
+
+    /* Powers of two within the 2-adicity are cheapest as a single radix-2 transform */
+    BOOST_CHECK(is_domain_of_kind(*make_evaluation_domain<fields::bls12_fr<381>>(16),
+                                  evaluation_domain_kind::basic_radix2));
+}
+
+BOOST_AUTO_TEST_CASE(geometric_repeated_fft) {
+    test_geometric_repeated_fft<fields::bls12_fr<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(precomputation_element) {
+    test_precomputation_element<fields::bls12_fr<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(geometric_precomputation) {
+    test_geometric_precomputation<fields::bls12_fr<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_domain_sizes) {
+    test_arithmetic_domain_sizes<fields::bls12_fr<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_precomputation) {
+    test_arithmetic_precomputation<fields::bls12_fr<381>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -66,4 +66,31 @@ BOOST_AUTO_TEST_CASE(polynomial_lagrange_interpolation_manual_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_lagrange_interpolation_random_test) {
+    using field_type = fields::bls12_fr<381>;
+    using value_type = typename field_type::value_type;
+
+    const std::size_t k = 100;
+    std::vector<value_type> xs(k);
+    std::vector<value_type> ys(k);
+    std::vector<std::pair<value_type, value_type>> points;
+    for (std::size_t i = 0; i < k; ++i) {
+        xs[i] = value_type(7 * i * i + 3 * i + 11);
+        ys[i] = value_type(13 * i + 2).squared();
+        points.emplace_back(xs[i], ys[i]);
+    }
+
+    polynomial<value_type> ans = lagrange_interpolation(xs, ys);
+    polynomial<value_type> ans_points = lagrange_interpolation(points);
+
+    BOOST_CHECK(ans.size() <= k);
+    BOOST_CHECK(ans == ans_points);
+    for (std::size_t i = 0; i < k; ++i) {
+        BOOST_CHECK(ans.evaluate(xs[i]) == ys[i]);
+    }
+
+    xs[k - 1] = xs[0];
+    BOOST_CHECK_THROW(lagrange_interpolation(xs, ys), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2022 Aleksei Moskvin <alalmoskvin@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#define BOOST_TEST_MODULE multilinear_polynomial_test
+
+#include <vector>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/math/polynomial/multilinear_polynomial.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+/* f(x_0, x_1, x_2) = 3 + 2 x_0 + 5 x_1 x_2 + 7 x_0 x_1 x_2 */
+value_type f_at(const value_type &x0, const value_type &x1, const value_type &x2) {
+    return value_type(3) + value_type(2) * x0 + value_type(5) * x1 * x2 + value_type(7) * x0 * x1 * x2;
+}
+
+multilinear_polynomial<value_type> f_table() {
+    multilinear_polynomial<value_type> f(3);
+    for (std::size_t i = 0; i < f.size(); i++) {
+        f[i] = f_at(value_type(i & 1), value_type((i >> 1) & 1), value_type((i >> 2) & 1));
+    }
+    return f;
+}
+
+BOOST_AUTO_TEST_SUITE(multilinear_polynomial_test_suite)
+
+BOOST_AUTO_TEST_CASE(multilinear_polynomial_evaluate) {
+
+    const multilinear_polynomial<value_type> f = f_table();
+    BOOST_CHECK_EQUAL(f.num_variables(), 3);
+
+    const std::vector<value_type> point = {value_type(4), value_type(9), value_type(11)};
+    BOOST_CHECK(f.evaluate(point) == f_at(point[0], point[1], point[2]));
+    BOOST_CHECK(f.evaluate(std::vector<value_type>({1, 0, 1})) == f[5]);
+
+    value_type s = value_type::zero();
+    for (const value_type &u : f) {
+        s += u;
+    }
+    BOOST_CHECK(f.sum() == s);
+
+    BOOST_CHECK(f + f == f * value_type(2));
+    BOOST_CHECK(f - f == multilinear_polynomial<value_type>(3));
+    BOOST_CHECK_THROW(f.evaluate(std::vector<value_type>(2)), std::invalid_argument);
+    BOOST_CHECK_THROW(multilinear_polynomial<value_type>({1, 2, 3}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(multilinear_polynomial_fold) {
+
+    const multilinear_polynomial<value_type> f = f_table();
+    const value_type r = value_type(6);
+
+    /* Folding fixes the last variable */
+    const multilinear_polynomial<value_type> g = f.fold(r);
+    BOOST_CHECK_EQUAL(g.num_variables(), 2);
+    const std::vector<value_type> point = {value_type(4), value_type(9)};
+    BOOST_CHECK(g.evaluate(point) == f_at(point[0], point[1], r));
+
+    /* In place folding gives the same table in the same memory */
+    multilinear_polynomial<value_type> h = f;
+    const value_type *table = h.data();
+    h.fold_in_place(r);
+    BOOST_CHECK(h == g);
+    BOOST_CHECK(h.data() == table);
+
+    h.fold_in_place(point[1]);
+    h.fold_in_place(point[0]);
+    BOOST_CHECK(h[0] == f_at(point[0], point[1], r));
+    BOOST_CHECK_THROW(h.fold_in_place(r), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(multilinear_polynomial_sumcheck_round) {
+
+    const std::size_t k = 14;
+    std::vector<multilinear_polynomial<value_type>> factors(3, multilinear_polynomial<value_type>(k));
+    for (std::size_t j = 0; j < factors.size(); j++) {
+        for (std::size_t i = 0; i < factors[j].size(); i++) {
+            factors[j][i] = value_type(i * i + 7 * j + 1);
+        }
+    }
+
+    /* Every round g(0) + g(1) matches the claim, which then becomes the sum after folding by r */
+    value_type claim = value_type::zero();
+    for (std::size_t i = 0; i < factors[0].size(); i++) {
+        claim += factors[0][i] * factors[1][i] * factors[2][i];
+    }
+    for (std::size_t round = 0; round < 3; round++) {
+        const std::vector<value_type> g = sumcheck_round(factors);
+        BOOST_CHECK_EQUAL(g.size(), factors.size() + 1);
+        BOOST_CHECK(g[0] + g[1] == claim);
+
+        /* g(t) for t > 1 is the product summed over the tables folded by t */
+        for (std::size_t t = 2; t < g.size(); t++) {
+            const multilinear_polynomial<value_type> a = factors[0].fold(value_type(t)),
+                                                     b = factors[1].fold(value_type(t)),
+                                                     c = factors[2].fold(value_type(t));
+            value_type expected = value_type::zero();
+            for (std::size_t i = 0; i < a.size(); i++) {
+                expected += a[i] * b[i] * c[i];
+            }
+            BOOST_CHECK(g[t] == expected);
+        }
+
+        const value_type r = value_type(round + 17);
+        for (multilinear_polynomial<value_type> &f : factors) {
+            f.fold_in_place(r);
+        }
+        claim = value_type::zero();
+        for (std::size_t i = 0; i < factors[0].size(); i++) {
+            claim += factors[0][i] * factors[1][i] * factors[2][i];
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -36,6 +36,10 @@
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_expression.hpp>
+#include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/polynomial/small_polynomial.hpp>
+#include <nil/crypto3/math/polynomial/sparse_polynomial.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
@@ -301,4 +305,250 @@ BOOST_AUTO_TEST_CASE(polynomial_division) {
     }
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_evaluation_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_evaluation_blocks) {
+
+    typedef typename FieldType::value_type value_type;
+
+    /* Long enough to be split into several evaluation blocks */
+    std::vector<polynomial<value_type>> polynomials;
+    for (std::size_t n : {1, 7, 1024, 3001}) {
+        polynomial<value_type> p(n);
+        for (std::size_t i = 0; i < n; i++) {
+            p[i] = value_type(i * i + 3 * n + 1);
+        }
+        polynomials.push_back(p);
+    }
+
+    const value_type t = value_type(0x1234567);
+    std::vector<value_type> expected;
+    for (const polynomial<value_type> &p : polynomials) {
+        value_type horner = value_type::zero();
+        for (std::size_t i = p.size(); i-- > 0;) {
+            horner = horner * t + p[i];
+        }
+        BOOST_CHECK_EQUAL(p.evaluate(t).data, horner.data);
+        expected.push_back(horner);
+    }
+
+    std::vector<value_type> values = evaluate_all_at(polynomials, t);
+    BOOST_CHECK(values == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_compound_assignment_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_compound_assignment) {
+
+    typedef typename FieldType::value_type value_type;
+
+    polynomial<value_type> a = {5, 0, 0, 13, 0, 1};
+    polynomial<value_type> b = {13, 0, 1};
+
+    polynomial<value_type> c = a;
+    c += b;
+    BOOST_CHECK(c == a + b);
+    c -= a;
+    BOOST_CHECK(c == b);
+    c *= a;
+    BOOST_CHECK(c == a * b);
+    c = b;
+    c -= c;
+    BOOST_CHECK(c == polynomial<value_type>());
+
+    /* An rvalue operand lends its buffer to the result */
+    polynomial<value_type> d = a;
+    const value_type *storage = d.data();
+    polynomial<value_type> r = std::move(d) + b;
+    BOOST_CHECK(r == a + b);
+    BOOST_CHECK(r.data() == storage);
+
+    storage = r.data();
+    r = std::move(r) - b - a;
+    BOOST_CHECK(r == polynomial<value_type>());
+    BOOST_CHECK(r.data() == storage);
+
+    polynomial<value_type> e = b;
+    storage = e.data();
+    polynomial<value_type> m(std::move(e));
+    BOOST_CHECK(m == b);
+    BOOST_CHECK(m.data() == storage);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_shift_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_shift_and_composition) {
+
+    typedef typename FieldType::value_type value_type;
+
+    /* (x + 1)^2 shifted by 2 is (x + 3)^2 */
+    polynomial<value_type> f = {1, 2, 1};
+    BOOST_CHECK(polynomial_taylor_shift<FieldType>(f, value_type(2)) == polynomial<value_type>({9, 6, 1}));
+    BOOST_CHECK(polynomial_shift<FieldType>(f, value_type(2)) == polynomial<value_type>({1, 4, 4}));
+
+    /* f(x + x^2) = 1 + 2x + 3x^2 + 2x^3 + x^4 */
+    polynomial<value_type> g = {0, 1, 1};
+    BOOST_CHECK(polynomial_compose<FieldType>(f, g, 3) == polynomial<value_type>({1, 2, 3}));
+    BOOST_CHECK(polynomial_compose<FieldType>(f, g, 10) == polynomial<value_type>({1, 2, 3, 2, 1}));
+
+    polynomial<value_type> h(200);
+    for (std::size_t i = 0; i < h.size(); i++) {
+        h[i] = value_type(i * i + 7);
+    }
+    const value_type a = value_type(0x1234567);
+    const value_type t = value_type(0x7654321);
+    BOOST_CHECK(polynomial_taylor_shift<FieldType>(h, a).evaluate(t) == h.evaluate(t + a));
+    BOOST_CHECK(polynomial_compose<FieldType>(h, polynomial<value_type>({a, 1}), 200) ==
+                polynomial_taylor_shift<FieldType>(h, a));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(small_polynomial_test_suite)
+
+BOOST_AUTO_TEST_CASE(small_polynomial_arithmetic) {
+
+    typedef typename FieldType::value_type value_type;
+    typedef small_polynomial<value_type, 4> small_type;
+
+    const polynomial<value_type> a = {1, 3, 4, 25, 6, 7, 7, 2};
+    const polynomial<value_type> b = {9, 3, 11, 14};
+    const small_type a_small(a), b_small(b);
+    BOOST_CHECK(!a_small.is_inline());
+    BOOST_CHECK(b_small.is_inline());
+
+    /* Every operation agrees with polynomial */
+    BOOST_CHECK(polynomial<value_type>(a_small + b_small) == a + b);
+    BOOST_CHECK(polynomial<value_type>(a_small - b_small) == a - b);
+    BOOST_CHECK(polynomial<value_type>(a_small * b_small) == a * b);
+    BOOST_CHECK(polynomial<value_type>(a_small / b_small) == a / b);
+    BOOST_CHECK(polynomial<value_type>(a_small % b_small) == a % b);
+    BOOST_CHECK(polynomial<value_type>(-b_small) == -b);
+    BOOST_CHECK(a_small.evaluate(value_type(7)) == a.evaluate(value_type(7)));
+
+    /* Low-degree products stay inline */
+    const small_type x_minus_one = {-value_type::one(), value_type::one()};
+    const small_type x_plus_one = {value_type::one(), value_type::one()};
+    small_type c = x_minus_one * x_plus_one;
+    BOOST_CHECK(c.is_inline());
+    BOOST_CHECK(c == small_type({-value_type::one(), value_type::zero(), value_type::one()}));
+    BOOST_CHECK(c / x_plus_one == x_minus_one);
+    BOOST_CHECK(c % x_plus_one == small_type());
+
+    c *= value_type(3);
+    c -= small_type(value_type(3), 2);
+    BOOST_CHECK(c == small_type(-value_type(3)));
+    c += small_type(value_type(3));
+    BOOST_CHECK(c.is_zero());
+    BOOST_CHECK_THROW(x_plus_one / c, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sparse_polynomial_test_suite)
+
+BOOST_AUTO_TEST_CASE(sparse_polynomial_arithmetic) {
+
+    typedef typename FieldType::value_type value_type;
+    typedef sparse_polynomial<value_type> sparse_type;
+
+    /* Terms are sorted and merged, zero coefficients dropped */
+    const sparse_type z = {{8, value_type::one()}, {0, -value_type::one()}, {3, value_type::zero()}};
+    BOOST_CHECK_EQUAL(z.size(), 2);
+    BOOST_CHECK_EQUAL(z.degree(), 8);
+    BOOST_CHECK(z[8] == value_type::one() && z[3] == value_type::zero());
+    BOOST_CHECK(z + sparse_type(value_type::one()) == sparse_type(value_type::one(), 8));
+    BOOST_CHECK((z - z).is_zero());
+
+    const polynomial<value_type> dense_z = {-1, 0, 0, 0, 0, 0, 0, 0, 1};
+    BOOST_CHECK(polynomial<value_type>(z) == dense_z);
+    BOOST_CHECK(sparse_type(dense_z) == z);
+    BOOST_CHECK(z.evaluate(value_type(3)) == dense_z.evaluate(value_type(3)));
+
+    /* Mixed sparse and dense operations agree with the dense ones */
+    const polynomial<value_type> a = {1, 3, 4, 25, 6, 7, 7, 2, 5, 1, 9, 12};
+    const sparse_type s = {{5, value_type(2)}, {1, value_type(7)}, {0, value_type(3)}};
+    const polynomial<value_type> dense_s(s);
+    BOOST_CHECK(a + s == a + dense_s);
+    BOOST_CHECK(s - a == dense_s - a);
+    BOOST_CHECK(a * s == a * dense_s);
+    BOOST_CHECK(s * z == sparse_type(dense_s * dense_z));
+    BOOST_CHECK(a / z == a / dense_z);
+    BOOST_CHECK(a % z == a % dense_z);
+    BOOST_CHECK(a / s == a / dense_s);
+    BOOST_CHECK(a % s == a % dense_s);
+    BOOST_CHECK_THROW(a / sparse_type(), std::invalid_argument);
+
+    polynomial<value_type> b = a;
+    b -= value_type(2) * s;
+    b += s * value_type(2);
+    BOOST_CHECK(b == a);
+
+    /* Point-value form, resized when the sparse term does not fit */
+    const std::size_t n = 4;
+    const polynomial<value_type> c = {3, 1, 4, 1};
+    const value_type omega = unity_root<FieldType>(n);
+    polynomial_dfs<value_type> c_dfs(c.degree(), n);
+    for (std::size_t i = 0; i < n; i++) {
+        c_dfs[i] = c.evaluate(omega.pow(i));
+    }
+    polynomial_dfs<value_type> sum = c_dfs + z;
+    BOOST_CHECK_EQUAL(sum.degree(), 8);
+    BOOST_CHECK(polynomial<value_type>(sum.coefficients()) == c + z);
+    BOOST_CHECK(polynomial<value_type>((c_dfs * s).coefficients()) == c * s);
+    BOOST_CHECK(polynomial<value_type>((sum - z).coefficients()) == c);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_expression_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_expression_linear_combination) {
+
+    polynomial<typename FieldType::value_type> a = {5, 0, 0, 13, 0, 1};
+    polynomial<typename FieldType::value_type> b = {13, 0, 1};
+    polynomial<typename FieldType::value_type> c = {1, 2};
+
+    polynomial<typename FieldType::value_type> r = lazy(a) - b + typename FieldType::value_type(2) * lazy(c);
+    polynomial<typename FieldType::value_type> r_ans = {-6, 4, -1, 13, 0, 1};
+
+    BOOST_CHECK(r == r_ans);
+
+    r = lazy(a) - a;
+    BOOST_CHECK(r == polynomial<typename FieldType::value_type>());
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_expression_products) {
+
+    typedef typename FieldType::value_type value_type;
+
+    /* Large enough for the products to be summed in the evaluation domain */
+    polynomial<value_type> a(300), b(200), c(250);
+    for (std::size_t i = 0; i < a.size(); i++) {
+        a[i] = value_type(3 * i + 1);
+    }
+    for (std::size_t i = 0; i < b.size(); i++) {
+        b[i] = value_type(i * i + 2);
+    }
+    for (std::size_t i = 0; i < c.size(); i++) {
+        c[i] = value_type(7 * i + 5);
+    }
+
+    polynomial<value_type> r = lazy(a) * b - value_type(3) * lazy(a) * c + (lazy(b) + c) * (lazy(a) - b) + c;
+    polynomial<value_type> r_ans = a * b - polynomial<value_type>(value_type(3)) * a * c + (b + c) * (a - b) + c;
+    BOOST_CHECK(r == r_ans);
+
+    /* Small operands go through the multiplication engine, the result may alias an operand */
+    polynomial<value_type> d = {1, 2, 3};
+    polynomial<value_type> d_ans = d * d * d - d;
+    d = lazy(d) * d * d - d;
+    BOOST_CHECK(d == d_ans);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
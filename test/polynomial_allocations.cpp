@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2022 Aleksei Moskvin <alalmoskvin@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#define BOOST_TEST_MODULE polynomial_allocations_test
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+/*
+ * Heap allocations made through the global operator new. This executable replaces it, so the counts
+ * below cover every container the operators create.
+ */
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    ++allocations;
+    if (void *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+template<typename Function>
+std::size_t count_allocations(const std::string &label, Function f) {
+    allocations = 0;
+    f();
+    const std::size_t count = allocations;
+    BOOST_TEST_MESSAGE(label << ": " << count << " allocations");
+    return count;
+}
+
+polynomial<value_type> make_polynomial(std::size_t n, std::size_t step) {
+    polynomial<value_type> p(n);
+    for (std::size_t i = 0; i < n; i++) {
+        p[i] = value_type(i * step + 1);
+    }
+    return p;
+}
+
+BOOST_AUTO_TEST_SUITE(polynomial_allocations_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_allocations) {
+    const polynomial<value_type> a = make_polynomial(1000, 3), b = make_polynomial(1000, 5),
+                                 c = make_polynomial(600, 7);
+    polynomial<value_type> r;
+
+    /* Chains reuse the buffer of the first temporary */
+    BOOST_CHECK_EQUAL(count_allocations("r = a + b", [&]() { r = a + b; }), 1);
+    BOOST_CHECK_EQUAL(count_allocations("r = a + b + c", [&]() { r = a + b + c; }), 1);
+    BOOST_CHECK_EQUAL(count_allocations("r = a - b - c", [&]() { r = a - b - c; }), 1);
+    BOOST_CHECK(count_allocations("r = a * b", [&]() { r = a * b; }) <= 3);
+    BOOST_CHECK(count_allocations("r = a * b + c", [&]() { r = a * b + c; }) <= 3);
+    BOOST_CHECK_EQUAL(count_allocations("move construction", [&]() { polynomial<value_type> m(std::move(r)); }), 0);
+
+    const std::vector<value_type> x(a.begin(), a.end()), y(b.begin(), b.end());
+    std::vector<value_type> z;
+    BOOST_CHECK(count_allocations("fft_multiplication", [&]() { fft_multiplication(z, x, y); }) <= 2);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_allocations) {
+    const polynomial<value_type> a = make_polynomial(1000, 3), b = make_polynomial(1000, 5);
+    polynomial_dfs<value_type> da, db, r;
+    da.from_coefficients(std::vector<value_type>(a.begin(), a.end()));
+    db.from_coefficients(std::vector<value_type>(b.begin(), b.end()));
+
+    BOOST_CHECK_EQUAL(count_allocations("dfs r = a + b + a", [&]() { r = da + db + da; }), 1);
+    BOOST_CHECK(count_allocations("dfs r = a * b", [&]() { r = da * db; }) <= 4);
+    BOOST_CHECK_EQUAL(
+        count_allocations("dfs move construction", [&]() { polynomial_dfs<value_type> m(std::move(r)); }), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
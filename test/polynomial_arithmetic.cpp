@@ -38,6 +38,10 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/xgcd.hpp>
+#include <nil/crypto3/math/polynomial/subproduct_tree.hpp>
+#include <nil/crypto3/math/polynomial/multipoint_evaluation.hpp>
+#include <nil/crypto3/math/polynomial/power_series.hpp>
+#include <nil/crypto3/math/detail/arena.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
@@ -264,6 +268,88 @@ BOOST_AUTO_TEST_CASE(polynomial_multiplication_zero_b) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_multiplication_algorithms) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    /* Sizes around each threshold of the multiplication engine, balanced and unbalanced */
+    const std::vector<std::size_t> sizes = {1, 7, 15, 16, 17, 40, 63, 64, 65, 127, 128, 129, 300};
+
+    for (std::size_t a_size : sizes) {
+        for (std::size_t b_size : sizes) {
+            std::vector<value_type> a(a_size), b(b_size);
+            for (std::size_t i = 0; i < a_size; i++) {
+                a[i] = value_type(7 * i * i + 3 * a_size + 1);
+            }
+            for (std::size_t i = 0; i < b_size; i++) {
+                b[i] = value_type(5 * i + 11 * b_size + 2);
+            }
+
+            std::vector<value_type> c_ans(a_size + b_size - 1, value_type::zero());
+            for (std::size_t i = 0; i < a_size; i++) {
+                for (std::size_t j = 0; j < b_size; j++) {
+                    c_ans[i + j] += a[i] * b[j];
+                }
+            }
+
+            std::vector<value_type> c;
+            nil::crypto3::math::multiplication(c, a, b);
+            BOOST_CHECK(c == c_ans);
+
+            if (a_size == b_size) {
+                std::vector<value_type> s_ans(2 * a_size - 1, value_type::zero());
+                for (std::size_t i = 0; i < a_size; i++) {
+                    for (std::size_t j = 0; j < a_size; j++) {
+                        s_ans[i + j] += a[i] * a[j];
+                    }
+                }
+
+                nil::crypto3::math::multiplication(a, a, a);
+                BOOST_CHECK(a == s_ans);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_transformed_multiplication) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    const std::size_t n = 64;
+    std::vector<value_type> b(20);
+    for (std::size_t i = 0; i < b.size(); i++) {
+        b[i] = value_type(3 * i * i + 2);
+    }
+
+    /* One FFT image of b serves every product, including ones that wrap modulo x^n - 1 */
+    std::vector<value_type> b_fft(b);
+    b_fft.resize(n, value_type::zero());
+    nil::crypto3::math::detail::basic_serial_radix2_fft<ScalarFieldType>(
+        b_fft, nil::crypto3::math::unity_root<ScalarFieldType>(n));
+
+    for (std::size_t a_size : {1, 13, 45, 64}) {
+        std::vector<value_type> a(a_size);
+        for (std::size_t i = 0; i < a_size; i++) {
+            a[i] = value_type(11 * i + a_size);
+        }
+
+        std::vector<value_type> c_ans(n, value_type::zero());
+        for (std::size_t i = 0; i < a_size; i++) {
+            for (std::size_t j = 0; j < b.size(); j++) {
+                c_ans[(i + j) % n] += a[i] * b[j];
+            }
+        }
+        condense(c_ans);
+
+        std::vector<value_type> c;
+        nil::crypto3::math::transformed_multiplication(c, a, b_fft);
+        BOOST_CHECK(c == c_ans);
+    }
+
+    std::vector<value_type> too_long(n + 1, value_type::one()), c;
+    BOOST_CHECK_THROW(nil::crypto3::math::transformed_multiplication(c, too_long, b_fft), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_CASE(polynomial_division1) {
@@ -340,6 +426,203 @@ BOOST_AUTO_TEST_CASE(polynomial_division2) {
     BOOST_CHECK(R_ans == R);
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_division_newton) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    /* Large enough for the quotient to go through power_series_inverse */
+    std::vector<value_type> a(700), b(300);
+    for (std::size_t i = 0; i < a.size(); i++) {
+        a[i] = value_type(3 * i * i + 7 * i + 1);
+    }
+    for (std::size_t i = 0; i < b.size(); i++) {
+        b[i] = value_type(5 * i + 2);
+    }
+
+    std::vector<value_type> q, r;
+    nil::crypto3::math::division(q, r, a, b);
+
+    BOOST_CHECK_EQUAL(q.size(), a.size() - b.size() + 1);
+    BOOST_CHECK(r.size() < b.size());
+
+    std::vector<value_type> c;
+    nil::crypto3::math::multiplication(c, q, b);
+    nil::crypto3::math::addition(c, c, r);
+    BOOST_CHECK(c == a);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_divide_by_binomial) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    std::vector<value_type> f(300);
+    for (std::size_t i = 0; i < f.size(); i++) {
+        f[i] = value_type(3 * i * i + 5 * i + 2);
+    }
+
+    for (const value_type &c : {value_type::one(), value_type(7)}) {
+        std::vector<value_type> b(65, value_type::zero());
+        b[64] = value_type::one();
+        b[0] = -c;
+
+        std::vector<value_type> q, r;
+        divide_by_binomial(q, r, f, 64, c);
+        BOOST_CHECK(r.size() < b.size());
+
+        std::vector<value_type> product;
+        nil::crypto3::math::multiplication(product, q, b);
+        nil::crypto3::math::addition(product, product, r);
+        BOOST_CHECK(product == f);
+    }
+
+    /* A sparse divisor that is not a binomial goes through the same term by term division */
+    polynomial<value_type> a(f.begin(), f.end());
+    polynomial<value_type> b(101, value_type::zero());
+    b[100] = value_type(3);
+    b[40] = value_type(2);
+    b[0] = value_type(5);
+
+    polynomial<value_type> Q = a / b;
+    polynomial<value_type> R = a % b;
+    BOOST_CHECK(R.size() < b.size());
+    BOOST_CHECK(Q * b + R == a);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_synthetic_division) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    std::vector<value_type> f(500);
+    for (std::size_t i = 0; i < f.size(); i++) {
+        f[i] = value_type(7 * i * i + i + 4);
+    }
+    const value_type z = value_type(0x1234567);
+
+    std::vector<value_type> q, q_ans, r_ans;
+    value_type r = synthetic_division(q, f, z);
+
+    nil::crypto3::math::division(q_ans, r_ans, f, std::vector<value_type>({-z, value_type::one()}));
+    BOOST_CHECK(q == q_ans);
+    BOOST_CHECK(r == r_ans[0]);
+    BOOST_CHECK(r == polynomial<value_type>(f.begin(), f.end()).evaluate(z));
+
+    /* Several polynomials by the same divisor */
+    std::vector<std::vector<value_type>> polynomials = {f, std::vector<value_type>(f.begin(), f.begin() + 3), {5}};
+    std::vector<std::vector<value_type>> quotients;
+    std::vector<value_type> remainders = batch_synthetic_division(quotients, polynomials, z);
+    BOOST_CHECK_EQUAL(quotients.size(), polynomials.size());
+    for (std::size_t k = 0; k < polynomials.size(); k++) {
+        std::vector<value_type> quotient;
+        BOOST_CHECK(remainders[k] == synthetic_division(quotient, polynomials[k], z));
+        BOOST_CHECK(quotients[k] == quotient);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_power_series) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    const std::size_t n = 300;
+    auto truncated_product = [n](const std::vector<value_type> &a, const std::vector<value_type> &b) {
+        std::vector<value_type> c(n, value_type::zero());
+        for (std::size_t i = 0; i < std::min(a.size(), n); i++) {
+            for (std::size_t j = 0; j < std::min(b.size(), n - i); j++) {
+                c[i + j] += a[i] * b[j];
+            }
+        }
+        return c;
+    };
+
+    std::vector<value_type> f(n);
+    for (std::size_t i = 0; i < n; i++) {
+        f[i] = value_type(5 * i * i + 3 * i + 1);
+    }
+
+    std::vector<value_type> one(n, value_type::zero());
+    one[0] = value_type::one();
+    BOOST_CHECK(truncated_product(f, power_series_inverse(f, n)) == one);
+
+    /* F * log(F)' = F' */
+    std::vector<value_type> g = power_series_log(f, n);
+    BOOST_CHECK_EQUAL(g.size(), n);
+    BOOST_CHECK(g[0] == value_type::zero());
+    std::vector<value_type> g_derivative(n, value_type::zero()), f_derivative(n, value_type::zero());
+    for (std::size_t i = 1; i < n; i++) {
+        g_derivative[i - 1] = g[i] * value_type(i);
+        f_derivative[i - 1] = f[i] * value_type(i);
+    }
+    std::vector<value_type> lhs = truncated_product(f, g_derivative);
+    BOOST_CHECK(std::equal(lhs.begin(), lhs.end() - 1, f_derivative.begin()));
+
+    BOOST_CHECK(power_series_exp(g, n) == f);
+    BOOST_CHECK(power_series_log(power_series_exp(g, n), n) == g);
+
+    std::vector<value_type> h = power_series_sqrt(f, n);
+    BOOST_CHECK(truncated_product(h, h) == f);
+    BOOST_CHECK(power_series_sqrt(truncated_product(h, h), n) == h);
+
+    /* The product of linear factors (1 - a_i x) as the exponential of the sum of their logarithms */
+    std::vector<value_type> product = {value_type::one()}, logarithm(n, value_type::zero());
+    for (std::size_t i = 0; i < 100; i++) {
+        const value_type a = value_type(i * i + 11);
+        product = truncated_product(product, {value_type::one(), -a});
+        std::vector<value_type> factor_log = power_series_log(std::vector<value_type>({value_type::one(), -a}), n);
+        for (std::size_t j = 0; j < n; j++) {
+            logarithm[j] += factor_log[j];
+        }
+    }
+    BOOST_CHECK(power_series_exp(logarithm, n) == product);
+
+    BOOST_CHECK_THROW(power_series_log(std::vector<value_type>({value_type(2)}), n), std::invalid_argument);
+    BOOST_CHECK_THROW(power_series_exp(std::vector<value_type>({value_type(2)}), n), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_arena) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+    typedef polynomial<value_type, arena_allocator<value_type>> arena_polynomial;
+
+    std::vector<value_type> a(700), b(300);
+    for (std::size_t i = 0; i < a.size(); i++) {
+        a[i] = value_type(i * i + 3);
+    }
+    for (std::size_t i = 0; i < b.size(); i++) {
+        b[i] = value_type(5 * i + 1);
+    }
+    std::vector<value_type> product, q, r, g, u, v;
+    nil::crypto3::math::multiplication(product, a, b);
+    nil::crypto3::math::division(q, r, a, b);
+    extended_euclidean(a, b, g, u, v);
+
+    std::vector<unsigned char> buffer(1 << 16);
+    {
+        arena outer(buffer.data(), buffer.size());
+        BOOST_CHECK(arena_resource() == &outer);
+
+        /* Results in arena memory and results on the heap agree */
+        arena_polynomial a_arena(a.begin(), a.end()), b_arena(b.begin(), b.end());
+        BOOST_CHECK(a_arena.get_allocator().resource == &outer);
+        arena_polynomial p_arena = a_arena * b_arena;
+        BOOST_CHECK(p_arena.get_allocator().resource == &outer);
+        BOOST_CHECK(std::vector<value_type>(p_arena.begin(), p_arena.end()) == product);
+        arena_polynomial q_arena = a_arena / b_arena, r_arena = a_arena % b_arena;
+        BOOST_CHECK(std::vector<value_type>(q_arena.begin(), q_arena.end()) == q);
+        BOOST_CHECK(std::vector<value_type>(r_arena.begin(), r_arena.end()) == r);
+
+        {
+            arena inner;
+            BOOST_CHECK(arena_resource() == &inner);
+            std::vector<value_type> g_inner, u_inner, v_inner;
+            extended_euclidean(a, b, g_inner, u_inner, v_inner);
+            BOOST_CHECK(g_inner == g);
+            BOOST_CHECK(u_inner == u);
+            BOOST_CHECK(v_inner == v);
+        }
+        BOOST_CHECK(arena_resource() == &outer);
+    }
+    BOOST_CHECK(arena_resource() == std::pmr::new_delete_resource());
+}
+
 BOOST_AUTO_TEST_CASE(extended_gcd) {
 
     std::vector<typename ScalarFieldType::value_type> a = {0, 0, 0, 0, 1};
@@ -357,3 +640,113 @@ BOOST_AUTO_TEST_CASE(extended_gcd) {
         BOOST_CHECK_EQUAL(pv_ans[i].data, pv[i].data);
     }
 }
+
+BOOST_AUTO_TEST_CASE(extended_gcd_half_gcd) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    /* Degrees well above half_gcd_threshold, with a common factor of degree 20 */
+    std::vector<value_type> a(400), b(350), c(21);
+    for (std::size_t i = 0; i < a.size(); i++) {
+        a[i] = value_type(i * i + 3);
+    }
+    for (std::size_t i = 0; i < b.size(); i++) {
+        b[i] = value_type(7 * i + 1).squared();
+    }
+    for (std::size_t i = 0; i < c.size(); i++) {
+        c[i] = value_type(i + 2);
+    }
+    c.back() = value_type::one();
+    multiplication(a, a, c);
+    multiplication(b, b, c);
+
+    std::vector<value_type> g, u, v;
+    extended_euclidean(a, b, g, u, v);
+
+    BOOST_CHECK(g.back() == value_type::one());
+    BOOST_CHECK(g.size() >= c.size());
+
+    std::vector<value_type> q, r;
+    division(q, r, a, g);
+    BOOST_CHECK(is_zero(r));
+    division(q, r, b, g);
+    BOOST_CHECK(is_zero(r));
+
+    std::vector<value_type> s, t;
+    multiplication(s, a, u);
+    multiplication(t, b, v);
+    addition(s, s, t);
+    BOOST_CHECK(s == g);
+}
+
+BOOST_AUTO_TEST_CASE(subproduct_tree_nodes) {
+
+    std::vector<typename ScalarFieldType::value_type> points = {1, 2, 3, 4, 5};
+
+    subproduct_tree<ScalarFieldType> T(points);
+
+    BOOST_CHECK_EQUAL(T.depth(), 3);
+    BOOST_CHECK_EQUAL(T.nodes(1), 3);
+
+    std::vector<typename ScalarFieldType::value_type> node_ans = {12, -7, 1};
+    BOOST_CHECK(T.node(1, 1) == node_ans);
+
+    std::vector<typename ScalarFieldType::value_type> root_ans = {-120, 274, -225, 85, -15, 1};
+    BOOST_CHECK(T.root() == root_ans);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_multipoint_evaluation) {
+
+    std::vector<typename ScalarFieldType::value_type> f(150);
+    for (std::size_t i = 0; i < f.size(); i++) {
+        f[i] = typename ScalarFieldType::value_type(3 * i * i + 7 * i + 1);
+    }
+
+    std::vector<typename ScalarFieldType::value_type> points(100);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        points[i] = typename ScalarFieldType::value_type(11 * i + 5).squared();
+    }
+
+    point_set<ScalarFieldType> S(points);
+    std::vector<typename ScalarFieldType::value_type> values = S.evaluate(f);
+
+    polynomial<typename ScalarFieldType::value_type> p(f.begin(), f.end());
+
+    BOOST_CHECK_EQUAL(values.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        BOOST_CHECK(values[i] == p.evaluate(points[i]));
+    }
+
+    std::vector<typename ScalarFieldType::value_type> g(f.begin(), f.begin() + 10);
+    values = multipoint_evaluation<ScalarFieldType>(g, points);
+    p = polynomial<typename ScalarFieldType::value_type>(g.begin(), g.end());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        BOOST_CHECK(values[i] == p.evaluate(points[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_evaluate_at_points) {
+
+    typedef typename ScalarFieldType::value_type value_type;
+
+    std::vector<value_type> f(300);
+    for (std::size_t i = 0; i < f.size(); i++) {
+        f[i] = value_type(5 * i * i + 3);
+    }
+
+    /* Not a multiple of the tile size */
+    std::vector<value_type> points(37);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        points[i] = value_type(13 * i + 2).squared();
+    }
+
+    std::vector<value_type> values = evaluate_at_points(f, points);
+    std::vector<value_type> tree_values = point_set<ScalarFieldType>(points).evaluate(f);
+
+    polynomial<value_type> p(f.begin(), f.end());
+    BOOST_CHECK_EQUAL(values.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        BOOST_CHECK(values[i] == p.evaluate(points[i]));
+        BOOST_CHECK(values[i] == tree_values[i]);
+    }
+}
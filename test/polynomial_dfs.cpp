@@ -27,6 +27,7 @@
 #define BOOST_TEST_MODULE polynomial_dfs_test
 
 #include <vector>
+#include <thread>
 #include <cstdint>
 
 #include <boost/test/unit_test.hpp>
@@ -35,6 +36,7 @@
 
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
 
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 
 using namespace nil::crypto3::algebra;
@@ -575,6 +577,79 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_multiplication_resize_both) {
 }
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_evaluation_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_evaluation) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> coefficients(37);
+    for (std::size_t i = 0; i < coefficients.size(); i++) {
+        coefficients[i] = value_type(5 * i * i + 2);
+    }
+    polynomial<value_type> p(coefficients.begin(), coefficients.end());
+    polynomial_dfs<value_type> a;
+    a.from_coefficients(coefficients);
+
+    const value_type t = value_type(0x1234567);
+    BOOST_CHECK_EQUAL(a.evaluate(t).data, p.evaluate(t).data);
+
+    /* A point of the evaluation domain reads the stored value */
+    const value_type omega = unity_root<FieldType>(a.size());
+    BOOST_CHECK_EQUAL(a.evaluate(omega.pow(5)).data, a[5].data);
+
+    std::vector<value_type> points = {t, value_type(3), omega};
+    std::vector<value_type> values = a.evaluate(points);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        BOOST_CHECK_EQUAL(values[i].data, p.evaluate(points[i]).data);
+    }
+
+    std::vector<polynomial_dfs<value_type>> polynomials = {a, a * a, -a};
+    values = barycentric_evaluate_all_at(polynomials, t);
+    BOOST_CHECK_EQUAL(values[0].data, p.evaluate(t).data);
+    BOOST_CHECK_EQUAL(values[1].data, (p * p).evaluate(t).data);
+    BOOST_CHECK_EQUAL(values[2].data, (-p).evaluate(t).data);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_compound_assignment_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_compound_assignment) {
+
+    typedef typename FieldType::value_type value_type;
+
+    polynomial_dfs<value_type> a, b;
+    a.from_coefficients(std::vector<value_type>({5, 0, 0, 13, 0, 1}));
+    b.from_coefficients(std::vector<value_type>({13, 0, 1}));
+
+    polynomial_dfs<value_type> c = b;
+    c += a;
+    BOOST_CHECK(c == a + b);
+    BOOST_CHECK_EQUAL(c.degree(), 5);
+    c -= a;
+    BOOST_CHECK(c.coefficients() == b.coefficients());
+
+    c = b;
+    c *= a;
+    BOOST_CHECK(c == a * b);
+    BOOST_CHECK_EQUAL(c.degree(), 7);
+
+    /* An rvalue operand lends its buffer to the result */
+    polynomial_dfs<value_type> d = a;
+    const value_type *storage = d.data();
+    polynomial_dfs<value_type> r = std::move(d) - b;
+    BOOST_CHECK(r == a - b);
+    BOOST_CHECK(r.data() == storage);
+
+    storage = r.data();
+    polynomial_dfs<value_type> m(std::move(r));
+    BOOST_CHECK(m == a - b);
+    BOOST_CHECK(m.data() == storage);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(polynomial_dfs_division_test_suite)
 
 BOOST_AUTO_TEST_CASE(polynomial_dfs_division) {
@@ -632,4 +707,176 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_division) {
     BOOST_CHECK_EQUAL(R_ans.degree(), R.degree());
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_CASE(polynomial_dfs_synthetic_division) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> coefficients(29);
+    for (std::size_t i = 0; i < coefficients.size(); i++) {
+        coefficients[i] = value_type(3 * i * i + 11);
+    }
+    polynomial<value_type> f(coefficients.begin(), coefficients.end());
+    polynomial_dfs<value_type> a;
+    a.from_coefficients(coefficients);
+
+    /* Outside the evaluation domain, then at one of its points */
+    const value_type omega = unity_root<FieldType>(a.size());
+    for (const value_type &z : {value_type(0x1234567), omega.pow(3)}) {
+        polynomial<value_type> q;
+        const value_type r = synthetic_division(q, f, z);
+
+        polynomial_dfs<value_type> q_dfs;
+        BOOST_CHECK_EQUAL(synthetic_division(q_dfs, a, z).data, r.data);
+        BOOST_CHECK_EQUAL(q_dfs.degree(), a.degree() - 1);
+
+        std::vector<value_type> q_coefficients = q_dfs.coefficients();
+        BOOST_CHECK(polynomial<value_type>(q_coefficients.begin(), q_coefficients.end()) == q);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_cached_coefficients_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_cached_coefficients) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> coefficients(13);
+    for (std::size_t i = 0; i < coefficients.size(); i++) {
+        coefficients[i] = value_type(5 * i + 2);
+    }
+    polynomial_dfs<value_type> a;
+    a.from_coefficients(coefficients);
+    a.cache_coefficients();
+    const polynomial_dfs<value_type> original = a;
+
+    /* Resizing up and back down goes through the cached coefficients */
+    a.resize(64);
+    BOOST_CHECK(a.coefficients() == coefficients);
+    a.resize(16);
+    BOOST_CHECK(a == original);
+
+    /* Writing an evaluation drops them */
+    polynomial_dfs<value_type> b = a;
+    b[0] += value_type::one();
+    const polynomial_dfs<value_type> &b_ref = b;
+    const polynomial_dfs<value_type> fresh(b.degree(), b_ref.begin(), b_ref.end());
+    BOOST_CHECK(b.coefficients() == fresh.coefficients());
+    BOOST_CHECK(b.coefficients() != coefficients);
+    BOOST_CHECK(a.coefficients() == coefficients);
+
+    /* Quotients and remainders keep the coefficients they were computed from */
+    polynomial_dfs<value_type> divisor;
+    divisor.from_coefficients(std::vector<value_type>({1, 0, 1}));
+    std::vector<value_type> q, r;
+    division(q, r, coefficients, std::vector<value_type>({1, 0, 1}));
+    const polynomial_dfs<value_type> q_dfs = a / divisor, r_dfs = a % divisor;
+    BOOST_CHECK(q_dfs.coefficients() == q);
+    BOOST_CHECK(r_dfs.coefficients() == r);
+    const polynomial_dfs<value_type> q_fresh(q_dfs.degree(), q_dfs.begin(), q_dfs.end());
+    BOOST_CHECK(q_fresh.coefficients() == q);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_cached_coefficients_concurrent_writes) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> coefficients(50);
+    for (std::size_t i = 0; i < coefficients.size(); i++) {
+        coefficients[i] = value_type(3 * i + 1);
+    }
+    polynomial_dfs<value_type> a;
+    a.from_coefficients(coefficients);
+    a.cache_coefficients();
+
+    /* Threads writing disjoint evaluations of a polynomial holding cached coefficients */
+    const std::size_t threads_count = 8, chunk = a.size() / threads_count;
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threads_count; t++) {
+        threads.emplace_back([&a, t, chunk]() {
+            for (std::size_t i = t * chunk; i < (t + 1) * chunk; i++) {
+                a[i] += value_type(i + 7);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    const polynomial_dfs<value_type> &a_ref = a;
+    const polynomial_dfs<value_type> fresh(a.degree(), a_ref.begin(), a_ref.end());
+    BOOST_CHECK(a.coefficients() == fresh.coefficients());
+    BOOST_CHECK(a.coefficients() != coefficients);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_cached_coefficients_write_after_read) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> coefficients(5);
+    for (std::size_t i = 0; i < coefficients.size(); i++) {
+        coefficients[i] = value_type(i + 2);
+    }
+    polynomial_dfs<value_type> a;
+    a.from_coefficients(coefficients);
+    const polynomial_dfs<value_type> &a_ref = a;
+
+    /* Without caching, references taken before a const read may be written through after it */
+    value_type &r = a[0];
+    const std::vector<value_type> before = a.coefficients();
+    r = value_type(99);
+    BOOST_CHECK(a.coefficients() != before);
+    BOOST_CHECK(a.coefficients() ==
+                polynomial_dfs<value_type>(a.degree(), a_ref.begin(), a_ref.end()).coefficients());
+
+    /* An iterator taken before caching is taken again before writing through it */
+    typename polynomial_dfs<value_type>::iterator it = a.begin();
+    *it += value_type::one();
+    a.cache_coefficients();
+    const std::vector<value_type> first = a.coefficients();
+    BOOST_CHECK(first != coefficients);
+    BOOST_CHECK(first == polynomial_dfs<value_type>(a.degree(), a_ref.begin(), a_ref.end()).coefficients());
+
+    it = a.begin();
+    it[1] += value_type::one();
+    a.cache_coefficients();
+    const std::vector<value_type> second = a.coefficients();
+    BOOST_CHECK(second != first);
+    BOOST_CHECK(second == polynomial_dfs<value_type>(a.degree(), a_ref.begin(), a_ref.end()).coefficients());
+
+    /* The same holds for data() */
+    a.cache_coefficients();
+    a.data()[2] += value_type::one();
+    BOOST_CHECK(a.coefficients() != second);
+    BOOST_CHECK(a.coefficients() ==
+                polynomial_dfs<value_type>(a.degree(), a_ref.begin(), a_ref.end()).coefficients());
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_cached_coefficients_move) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> coefficients(6);
+    for (std::size_t i = 0; i < coefficients.size(); i++) {
+        coefficients[i] = value_type(2 * i + 3);
+    }
+    polynomial_dfs<value_type> a;
+    a.from_coefficients(coefficients);
+    a.cache_coefficients();
+
+    /* The moved-to polynomial keeps the coefficients, the moved-from one forgets them */
+    polynomial_dfs<value_type> b(std::move(a));
+    BOOST_CHECK(b.coefficients() == coefficients);
+    BOOST_CHECK(a.coefficients().empty());
+    a.resize(8);
+    BOOST_CHECK(a.coefficients().empty());
+
+    polynomial_dfs<value_type> c;
+    c = std::move(b);
+    BOOST_CHECK(c.coefficients() == coefficients);
+    BOOST_CHECK(b.coefficients().empty());
+    b.resize(16);
+    BOOST_CHECK(b.coefficients().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()